@@ -25,6 +25,10 @@
 #include "otmorris/Morris.hxx"
 #include "otmorris/MorrisExperimentLHS.hxx"
 #include "otmorris/MorrisExperimentGrid.hxx"
+#include "otmorris/MorrisDatabase.hxx"
+#include "otmorris/MorrisSurrogate.hxx"
+#include "otmorris/MorrisPrincipalComponents.hxx"
+#include "otmorris/MorrisEnsemble.hxx"
 
 #endif
 
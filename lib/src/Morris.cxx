@@ -25,6 +25,13 @@
 #include <openturns/PersistentObjectFactory.hxx>
 #include <openturns/Cloud.hxx>
 #include <openturns/Text.hxx>
+#include <openturns/PolygonArray.hxx>
+#include <openturns/DrawableImplementation.hxx>
+#include <openturns/Log.hxx>
+#include <algorithm>
+#include <map>
+#include <vector>
+#include <cmath>
 
 
 using namespace OT;
@@ -39,6 +46,7 @@ static const Factory<Morris> Factory_Morris;
 /** Default constructor */
 Morris::Morris()
   : PersistentObject()
+  , savedCallsNumber_(0)
 {}
 
 /** Standard constructor */
@@ -50,6 +58,7 @@ Morris::Morris(const Sample & inputSample, const Sample & outputSample,  const I
   , elementaryEffectsMean_()
   , elementaryEffectsStandardDeviation_()
   , absoluteElementaryEffectsMean_()
+  , savedCallsNumber_(0)
 {
   const UnsignedInteger size = inputSample.getSize();
   if (outputSample.getSize() != size)
@@ -75,6 +84,7 @@ Morris::Morris(const MorrisExperiment & experiment, const Function & model)
   , elementaryEffectsMean_()
   , elementaryEffectsStandardDeviation_()
   , absoluteElementaryEffectsMean_()
+  , savedCallsNumber_(0)
 {
   const UnsignedInteger size = experiment.getSize();
   if (size == 0)
@@ -88,9 +98,10 @@ Morris::Morris(const MorrisExperiment & experiment, const Function & model)
   if (model.getInputDimension() != inputDimension)
     throw InvalidArgumentException(HERE) << "In Morris::Morris, model should have the same input dimension as sample. Here, input sample's dimension=" << inputDimension
                                          << ", model's input dimension=" << model.getInputDimension();
+  inputSample_.setDescription(model.getInputDescription());
 
-  // Evaluation of output design
-  outputSample_ = model(inputSample_);
+  // Evaluation of output design, once per distinct point
+  outputSample_ = EvaluateDistinctPoints(model, inputSample_, interval_, savedCallsNumber_);
 
   // Compute number of trajectories
   // We could remove one or several trajectories due to replicate
@@ -103,18 +114,66 @@ Morris::Morris(const MorrisExperiment & experiment, const Function & model)
 }
 
 
+/* Evaluate the model once per distinct point of the design */
+Sample Morris::EvaluateDistinctPoints(const Function & model, const Sample & inputSample, const Interval & interval, UnsignedInteger & savedCallsNumber)
+{
+  // Trajectories may share some points (LHS starting points, grid nodes),
+  // so the model is evaluated only once per distinct point
+  // Points are keyed on their coordinates normalized to the bounds and
+  // rounded to 2^-40, so that grid nodes reached along different paths
+  // are matched even if they differ by a rounding error
+  const UnsignedInteger sampleSize = inputSample.getSize();
+  const UnsignedInteger inputDimension = inputSample.getDimension();
+  const Point lowerBound(interval.getLowerBound());
+  const Point deltaBounds(interval.getUpperBound() - lowerBound);
+  for (UnsignedInteger j = 0; j < inputDimension; ++j)
+    if (!(deltaBounds[j] > 0.0))
+      throw InvalidArgumentException(HERE) << "In Morris::EvaluateDistinctPoints, bounds should have a positive width. Here, width of component " << j << "=" << deltaBounds[j];
+  std::map<std::vector<SignedInteger>, UnsignedInteger> uniquePoints;
+  std::vector<SignedInteger> key(inputDimension);
+  Indices uniqueIndices;
+  Indices representative(sampleSize);
+  for (UnsignedInteger i = 0; i < sampleSize; ++i)
+  {
+    for (UnsignedInteger j = 0; j < inputDimension; ++j)
+      key[j] = static_cast<SignedInteger>(std::llround(std::ldexp((inputSample(i, j) - lowerBound[j]) / deltaBounds[j], 40)));
+    const std::pair<std::map<std::vector<SignedInteger>, UnsignedInteger>::iterator, Bool> insertion(uniquePoints.insert(std::make_pair(key, uniqueIndices.getSize())));
+    if (insertion.second)
+      uniqueIndices.add(i);
+    representative[i] = insertion.first->second;
+  }
+  savedCallsNumber = sampleSize - uniqueIndices.getSize();
+  Log::Info(OSS() << "In Morris::EvaluateDistinctPoints, " << uniqueIndices.getSize() << " distinct points among " << sampleSize << ", saved " << savedCallsNumber << " model evaluations");
+
+  // Evaluation of the distinct points and scatter back to the full design
+  const Sample uniqueOutputSample(model(inputSample.select(uniqueIndices)));
+  Sample outputSample(sampleSize, uniqueOutputSample.getDimension());
+  for (UnsignedInteger i = 0; i < sampleSize; ++i)
+    outputSample[i] = uniqueOutputSample[representative[i]];
+  outputSample.setDescription(uniqueOutputSample.getDescription());
+  return outputSample;
+}
+
 // Method that allocate and compute effects
 void Morris::computeEffects(const UnsignedInteger N)
 {
-  // Allocate samples
   const UnsignedInteger inputDimension(inputSample_.getDimension());
   const UnsignedInteger outputDimension(outputSample_.getDimension());
+  const UnsignedInteger effectsDimension(inputDimension * outputDimension);
   const Point diff_bounds(interval_.getUpperBound() - interval_.getLowerBound());
-  Sample elementaryEffects(N, inputDimension * outputDimension);
-  Sample absoluteElementaryEffects(N, inputDimension * outputDimension);
   SquareMatrix dx(inputDimension, inputDimension);
   Matrix dy(inputDimension, outputDimension);
   Matrix ee;
+  // Running mean, mean of absolute values and sum of squared deviations
+  // of the effects, updated after each solve (Welford's algorithm)
+  // The effects of a trajectory are never stored
+  Point mean(effectsDimension);
+  Point absoluteMean(effectsDimension);
+  Point squaredDeviations(effectsDimension);
+  // The buffers do not overlap, so the update loop is vectorized without aliasing checks
+  Scalar * __restrict const meanData = &mean[0];
+  Scalar * __restrict const absoluteMeanData = &absoluteMean[0];
+  Scalar * __restrict const squaredDeviationsData = &squaredDeviations[0];
   // Perform evaluation of elementary effects
   // Requires k system solves
   UnsignedInteger blockIndex(0);
@@ -133,22 +192,51 @@ void Morris::computeEffects(const UnsignedInteger N)
     }
     // Solve linear system
     ee = dx.solveLinearSystem(dy);
-    // Stores the elementary effects
-    elementaryEffects[k] = Point(*ee.getImplementation());
-    absoluteElementaryEffects[k] = Point(*ee.getImplementation());
-    for (UnsignedInteger j = 0; j < inputDimension * outputDimension; ++j)
-      absoluteElementaryEffects[k][j] = std::abs(absoluteElementaryEffects[k][j]);
+    // Accumulate the elementary effects in a single pass over contiguous storage
+    const Scalar * __restrict const eeData = &(*ee.getImplementation())[0];
+    const Scalar weight = 1.0 / (k + 1.0);
+    for (UnsignedInteger j = 0; j < effectsDimension; ++j)
+      UpdateStatistics(eeData[j], weight, meanData[j], absoluteMeanData[j], squaredDeviationsData[j]);
     blockIndex += inputDimension + 1;
   } // end for k
+  setStatistics(mean, absoluteMean, squaredDeviations, Indices(inputDimension, N));
+}
+
+/* Welford update of the running statistics with a new elementary effect */
+void Morris::UpdateStatistics(const Scalar effect, const Scalar weight, Scalar & mean, Scalar & absoluteMean, Scalar & squaredDeviations)
+{
+  const Scalar deviation = effect - mean;
+  mean += weight * deviation;
+  absoluteMean += weight * (std::abs(effect) - absoluteMean);
+  squaredDeviations += deviation * (effect - mean);
+}
+
+/* Store the statistics from the running sums and the number of effects of each input */
+void Morris::setStatistics(const Point & mean, const Point & absoluteMean, const Point & squaredDeviations, const Indices & effectsNumber)
+{
+  const UnsignedInteger inputDimension = effectsNumber.getSize();
+  const UnsignedInteger effectsDimension = mean.getSize();
+  const UnsignedInteger outputDimension = effectsDimension / inputDimension;
+  // Unbiased standard deviation
+  Point standardDeviation(effectsDimension);
+  for (UnsignedInteger j = 0; j < effectsDimension; ++j)
+  {
+    const UnsignedInteger count = effectsNumber[j % inputDimension];
+    standardDeviation[j] = (count > 1) ? std::sqrt(squaredDeviations[j] / (count - 1.0)) : 0.0;
+  }
   // Allocate ee mean/std support
+  // The effects matrix is stored by columns so index j = input + output * inputDimension
   elementaryEffectsMean_ = Sample(outputDimension, inputDimension);
   absoluteElementaryEffectsMean_ = Sample(outputDimension, inputDimension);
   elementaryEffectsStandardDeviation_ = Sample(outputDimension, inputDimension);
-  // Evaluate mean/std
-  // elementary effects compute mean
-  elementaryEffectsMean_.getImplementation()->setData(elementaryEffects.computeMean());
-  absoluteElementaryEffectsMean_.getImplementation()->setData(absoluteElementaryEffects.computeMean());
-  elementaryEffectsStandardDeviation_.getImplementation()->setData(elementaryEffects.computeStandardDeviation());
+  elementaryEffectsMean_.getImplementation()->setData(mean);
+  absoluteElementaryEffectsMean_.getImplementation()->setData(absoluteMean);
+  elementaryEffectsStandardDeviation_.getImplementation()->setData(standardDeviation);
+  // Input description kept with the statistics
+  const Description inputDescription(inputSample_.getDescription());
+  elementaryEffectsMean_.setDescription(inputDescription);
+  absoluteElementaryEffectsMean_.setDescription(inputDescription);
+  elementaryEffectsStandardDeviation_.setDescription(inputDescription);
 }
 
 /* Virtual constructor method */
@@ -180,26 +268,110 @@ Point Morris::getStandardDeviationElementaryEffects(const UnsignedInteger margin
 
 
 /* Draw result */
-Graph Morris::drawElementaryEffects(UnsignedInteger outputMarginal, Bool absoluteMean) const
+Graph Morris::drawElementaryEffects(const UnsignedInteger outputMarginal,
+                                    const Bool absoluteMean,
+                                    const UnsignedInteger labelsNumber,
+                                    const Bool rankBySigma,
+                                    const UnsignedInteger binNumber) const
 {
-  if (outputMarginal >= outputSample_.getDimension())
+  if (outputMarginal >= elementaryEffectsMean_.getSize())
     throw InvalidArgumentException(HERE) << "Cannot exceed dimension";
   Graph graph(OSS() << "Elementary effects", "$\\mu$", "$\\sigma$", true);
   const Point mean(absoluteMean ? getMeanAbsoluteElementaryEffects(outputMarginal) : getMeanElementaryEffects(outputMarginal));
   const Point sigma(getStandardDeviationElementaryEffects(outputMarginal));
-  Sample sample(mean.getSize(), 2);
-  for (UnsignedInteger i = 0; i < mean.getSize(); ++ i)
+  const UnsignedInteger inputDimension = mean.getSize();
+  Sample sample(inputDimension, 2);
+  for (UnsignedInteger i = 0; i < inputDimension; ++ i)
   {
     sample(i, 0) = mean[i];
     sample(i, 1) = sigma[i];
   }
-  const Point delta(sample.getMax() - sample.getMin());
-  Cloud cloud(sample, "blue", "fcircle");
-  graph.add(cloud);
-  const Description inputDescription(inputSample_.getDescription());
-  for (UnsignedInteger i = 0; i < mean.getSize(); ++ i)
+  const Point minimum(sample.getMin());
+  const Point delta(sample.getMax() - minimum);
+
+  // Select the most influential inputs by partial selection, no full sort
+  const UnsignedInteger labelled = std::min(labelsNumber, inputDimension);
+  std::vector<UnsignedInteger> order(inputDimension);
+  for (UnsignedInteger i = 0; i < inputDimension; ++ i) order[i] = i;
+  if (labelled < inputDimension)
+  {
+    const Point criterion(rankBySigma ? sigma : mean);
+    std::nth_element(order.begin(), order.begin() + labelled, order.end(),
+                     [&criterion](const UnsignedInteger i, const UnsignedInteger j)
+    {
+      return std::abs(criterion[i]) > std::abs(criterion[j]);
+    });
+  }
+
+  if (binNumber > 0)
+  {
+    // The other inputs are rendered as a density map: one filled cell per
+    // non empty bin, with a color depending on the count
+    Indices counts(binNumber * binNumber, 0);
+    UnsignedInteger maximumCount = 0;
+    for (UnsignedInteger k = labelled; k < inputDimension; ++ k)
+    {
+      UnsignedInteger bin[2];
+      for (UnsignedInteger j = 0; j < 2; ++ j)
+      {
+        const Scalar position = (delta[j] > 0.0) ? (sample(order[k], j) - minimum[j]) / delta[j] : 0.0;
+        bin[j] = std::min(binNumber - 1, static_cast<UnsignedInteger>(position * binNumber));
+      }
+      const UnsignedInteger index = bin[0] + binNumber * bin[1];
+      ++ counts[index];
+      maximumCount = std::max(maximumCount, counts[index]);
+    }
+    Sample vertices(0, 2);
+    Description palette;
+    Point vertex(2);
+    for (UnsignedInteger index = 0; index < counts.getSize(); ++ index)
+    {
+      if (counts[index] == 0) continue;
+      const Scalar x0 = minimum[0] + delta[0] * (index % binNumber) / binNumber;
+      const Scalar y0 = minimum[1] + delta[1] * (index / binNumber) / binNumber;
+      const Scalar x1 = x0 + delta[0] / binNumber;
+      const Scalar y1 = y0 + delta[1] / binNumber;
+      vertex[0] = x0;
+      vertex[1] = y0;
+      vertices.add(vertex);
+      vertex[0] = x1;
+      vertices.add(vertex);
+      vertex[1] = y1;
+      vertices.add(vertex);
+      vertex[0] = x0;
+      vertices.add(vertex);
+      // From light to dark blue, log scale of the count
+      const Scalar level = std::log1p(static_cast<Scalar>(counts[index])) / std::log1p(static_cast<Scalar>(maximumCount));
+      palette.add(DrawableImplementation::ConvertFromRGB(0.85 * (1.0 - level), 0.85 * (1.0 - level) + 0.1 * level, 1.0 - 0.45 * level));
+    }
+    if (palette.getSize() > 0)
+      graph.add(PolygonArray(vertices, 4, palette));
+    if (labelled > 0)
+    {
+      Sample labelledSample(labelled, 2);
+      for (UnsignedInteger k = 0; k < labelled; ++ k)
+        labelledSample[k] = sample[order[k]];
+      graph.add(Cloud(labelledSample, "blue", "fcircle"));
+    }
+  }
+  else
+    graph.add(Cloud(sample, "blue", "fcircle"));
+
+  // All the labels in a single drawable
+  if (labelled > 0)
   {
-    Text text(Point(1, mean[i] + 0.02 * delta[0]), Point(1, sigma[i] + 0.01 * delta[1]), Description(1, inputDescription[i]));
+    const Description inputDescription(inputSample_.getDescription());
+    Point x(labelled);
+    Point y(labelled);
+    Description labels(labelled);
+    for (UnsignedInteger k = 0; k < labelled; ++ k)
+    {
+      const UnsignedInteger i = order[k];
+      x[k] = mean[i] + 0.02 * delta[0];
+      y[k] = sigma[i] + 0.01 * delta[1];
+      labels[k] = inputDescription[i];
+    }
+    Text text(x, y, labels);
     text.setTextSize(1.05);
     text.setColor("black");
     graph.add(text);
@@ -207,6 +379,30 @@ Graph Morris::drawElementaryEffects(UnsignedInteger outputMarginal, Bool absolut
   return graph;
 }
 
+/* Draw results of several outputs */
+GridLayout Morris::drawElementaryEffects(const Indices & outputMarginals,
+    const Bool absoluteMean,
+    const UnsignedInteger labelsNumber,
+    const Bool rankBySigma,
+    const UnsignedInteger binNumber) const
+{
+  const UnsignedInteger size = outputMarginals.getSize();
+  if (size == 0)
+    throw InvalidArgumentException(HERE) << "In Morris::drawElementaryEffects, output marginals should not be empty";
+  const UnsignedInteger columnsNumber = static_cast<UnsignedInteger>(std::ceil(std::sqrt(1.0 * size)));
+  const UnsignedInteger rowsNumber = (size + columnsNumber - 1) / columnsNumber;
+  GridLayout grid(rowsNumber, columnsNumber);
+  grid.setTitle("Elementary effects");
+  const Description outputDescription(outputSample_.getDescription());
+  for (UnsignedInteger k = 0; k < size; ++ k)
+  {
+    Graph graph(drawElementaryEffects(outputMarginals[k], absoluteMean, labelsNumber, rankBySigma, binNumber));
+    graph.setTitle(outputDescription[outputMarginals[k]]);
+    grid.setGraph(k / columnsNumber, k % columnsNumber, graph);
+  }
+  return grid;
+}
+
 /* String converter */
 String Morris::__repr__() const
 {
@@ -216,7 +412,8 @@ String Morris::__repr__() const
       << ", output sample=" << outputSample_
       << ", ee mean= " << elementaryEffectsMean_
       << ", absolute ee mean= " << absoluteElementaryEffectsMean_
-      << ", ee std= " << elementaryEffectsStandardDeviation_;
+      << ", ee std= " << elementaryEffectsStandardDeviation_
+      << ", saved calls number=" << savedCallsNumber_;
   return oss;
 }
 
@@ -230,27 +427,39 @@ Sample Morris::getOutputSample() const
   return outputSample_;
 }
 
+UnsignedInteger Morris::getSavedCallsNumber() const
+{
+  return savedCallsNumber_;
+}
+
 
 /* Method save() stores the object through the StorageManager */
 void Morris::save(Advocate & adv) const
 {
   PersistentObject::save( adv );
-  adv.saveAttribute( "inputSample_", inputSample_ );
-  adv.saveAttribute( "outputSample_", outputSample_ );
+  // Statistics first, then the bulk samples
   adv.saveAttribute( "elementaryEffectsMean_", elementaryEffectsMean_ );
   adv.saveAttribute( "elementaryEffectsStandardDeviation_", elementaryEffectsStandardDeviation_ );
   adv.saveAttribute( "absoluteElementaryEffectsMean_", absoluteElementaryEffectsMean_ );
+  adv.saveAttribute( "interval_", interval_ );
+  adv.saveAttribute( "savedCallsNumber_", savedCallsNumber_ );
+  adv.saveAttribute( "inputSample_", inputSample_ );
+  adv.saveAttribute( "outputSample_", outputSample_ );
 }
 
 /* Method load() reloads the object from the StorageManager */
 void Morris::load(Advocate & adv)
 {
   PersistentObject::load( adv );
-  adv.loadAttribute( "inputSample_", inputSample_ );
-  adv.loadAttribute( "outputSample_", outputSample_ );
   adv.loadAttribute( "elementaryEffectsMean_", elementaryEffectsMean_ );
   adv.loadAttribute( "elementaryEffectsStandardDeviation_", elementaryEffectsStandardDeviation_ );
   adv.loadAttribute( "absoluteElementaryEffectsMean_", absoluteElementaryEffectsMean_ );
+  if (adv.hasAttribute("interval_"))
+    adv.loadAttribute( "interval_", interval_ );
+  if (adv.hasAttribute("savedCallsNumber_"))
+    adv.loadAttribute( "savedCallsNumber_", savedCallsNumber_ );
+  adv.loadAttribute( "inputSample_", inputSample_ );
+  adv.loadAttribute( "outputSample_", outputSample_ );
 }
 
 
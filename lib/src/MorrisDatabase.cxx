@@ -0,0 +1,226 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief MorrisDatabase
+ *
+ *  Copyright 2005-2024 Airbus-EDF-IMACS-Phimeca
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+ *
+ */
+#include "otmorris/MorrisDatabase.hxx"
+
+#include <openturns/PersistentObjectFactory.hxx>
+#include <openturns/KDTree.hxx>
+#include <openturns/Log.hxx>
+#include <algorithm>
+#include <vector>
+#include <cmath>
+
+using namespace OT;
+
+namespace OTMORRIS
+{
+
+CLASSNAMEINIT(MorrisDatabase)
+
+static const Factory<MorrisDatabase> Factory_MorrisDatabase;
+
+/** Default constructor */
+MorrisDatabase::MorrisDatabase()
+  : Morris()
+  , tolerance_(0.0)
+  , pairsNumber_()
+{}
+
+/** Standard constructor */
+MorrisDatabase::MorrisDatabase(const Sample & inputSample, const Sample & outputSample, const Interval & interval, const Scalar tolerance)
+  : Morris()
+  , tolerance_(tolerance)
+  , pairsNumber_()
+{
+  const UnsignedInteger size = inputSample.getSize();
+  if (outputSample.getSize() != size)
+    throw InvalidArgumentException(HERE) << "In MorrisDatabase::MorrisDatabase, input & output samples should be of same size. Here, input sample's size=" << size
+                                         << ", output sample's size=" << outputSample.getSize();
+  if (size < 2)
+    throw InvalidArgumentException(HERE) << "In MorrisDatabase::MorrisDatabase, samples should contain at least 2 points";
+  if (interval.getDimension() != inputSample.getDimension())
+    throw InvalidArgumentException(HERE) << "In MorrisDatabase::MorrisDatabase, bounds should be of dimension " << inputSample.getDimension()
+                                         << ", here bounds's dimension=" << interval.getDimension();
+  if (!(tolerance >= 0.0))
+    throw InvalidArgumentException(HERE) << "In MorrisDatabase::MorrisDatabase, tolerance should be nonnegative, here tolerance=" << tolerance;
+  const Point deltaBounds(interval.getUpperBound() - interval.getLowerBound());
+  for (UnsignedInteger j = 0; j < deltaBounds.getDimension(); ++j)
+    if (!(deltaBounds[j] > 0.0))
+      throw InvalidArgumentException(HERE) << "In MorrisDatabase::MorrisDatabase, bounds should have a positive width. Here, width of component " << j << "=" << deltaBounds[j];
+  inputSample_ = inputSample;
+  outputSample_ = outputSample;
+  interval_ = interval;
+  // Perform evaluation of elementary effects
+  computePairEffects();
+}
+
+/* Virtual constructor method */
+MorrisDatabase * MorrisDatabase::clone() const
+{
+  return new MorrisDatabase(*this);
+}
+
+// Method that finds the pairs and computes the statistics
+void MorrisDatabase::computePairEffects()
+{
+  const UnsignedInteger size(inputSample_.getSize());
+  const UnsignedInteger inputDimension(inputSample_.getDimension());
+  const UnsignedInteger outputDimension(outputSample_.getDimension());
+  const UnsignedInteger effectsDimension(inputDimension * outputDimension);
+  // Coordinates normalized to the bounds, as for the trajectories
+  const Point lowerBound(interval_.getLowerBound());
+  const Point deltaBounds(interval_.getUpperBound() - lowerBound);
+  Sample normalized(size, inputDimension);
+  for (UnsignedInteger a = 0; a < size; ++a)
+    for (UnsignedInteger p = 0; p < inputDimension; ++p)
+      normalized(a, p) = (inputSample_(a, p) - lowerBound[p]) / deltaBounds[p];
+  // Running statistics (Welford's algorithm), index = input + output * inputDimension
+  Point mean(effectsDimension);
+  Point absoluteMean(effectsDimension);
+  Point squaredDeviations(effectsDimension);
+  pairsNumber_ = Indices(inputDimension, 0);
+  // The other coordinates of a pair may differ by up to the tolerance, which biases
+  // the effect by about tolerance / step: steps must be much larger than the tolerance
+  const Scalar minimumStep = 10.0 * tolerance_;
+  for (UnsignedInteger i = 0; i < inputDimension; ++i)
+  {
+    // For each point a, pair with the point b such that the other coordinates
+    // match within tolerance and b is the closest above a along axis i
+    Indices partner(size, size);
+    if (inputDimension == 1)
+    {
+      std::vector<std::pair<Scalar, UnsignedInteger> > sorted(size);
+      for (UnsignedInteger a = 0; a < size; ++a)
+        sorted[a] = std::make_pair(normalized(a, 0), a);
+      std::sort(sorted.begin(), sorted.end());
+      UnsignedInteger next = 0;
+      for (UnsignedInteger k = 0; k < size; ++k)
+      {
+        next = std::max(next, k + 1);
+        while ((next < size) && !(sorted[next].first - sorted[k].first > minimumStep)) ++next;
+        if (next < size)
+          partner[sorted[k].second] = sorted[next].second;
+      }
+    }
+    else
+    {
+      // Spatial index over the other coordinates
+      Indices otherAxes;
+      for (UnsignedInteger p = 0; p < inputDimension; ++p)
+        if (p != i) otherAxes.add(p);
+      const Sample projected(normalized.getMarginal(otherAxes));
+      const KDTree tree(projected);
+      // Max-norm within tolerance implies Euclidean norm within this radius
+      const Scalar radius = tolerance_ * std::sqrt(1.0 * otherAxes.getSize());
+      const UnsignedInteger initialCandidatesNumber = std::min(size, static_cast<UnsignedInteger>(8));
+      for (UnsignedInteger a = 0; a < size; ++a)
+      {
+        const Point xA(projected[a]);
+        // Enlarge the neighbourhood while its furthest point may still match
+        UnsignedInteger candidatesNumber = initialCandidatesNumber;
+        Indices neighbours(tree.queryK(xA, candidatesNumber, true));
+        while ((candidatesNumber < size) && !((Point(projected[neighbours[candidatesNumber - 1]]) - xA).norm() > radius))
+        {
+          candidatesNumber = std::min(size, 2 * candidatesNumber);
+          neighbours = tree.queryK(xA, candidatesNumber, true);
+        }
+        Scalar bestStep = SpecFunc::MaxScalar;
+        for (UnsignedInteger k = 0; k < candidatesNumber; ++k)
+        {
+          const UnsignedInteger b = neighbours[k];
+          const Scalar step = normalized(b, i) - normalized(a, i);
+          if (!(step > minimumStep) || !(step < bestStep)) continue;
+          Bool match = true;
+          for (UnsignedInteger p = 0; p < otherAxes.getSize() && match; ++p)
+            match = !(std::abs(projected(b, p) - xA[p]) > tolerance_);
+          if (match)
+          {
+            bestStep = step;
+            partner[a] = b;
+          }
+        }
+      }
+    }
+    // Accumulate the elementary effects of the pairs
+    for (UnsignedInteger a = 0; a < size; ++a)
+    {
+      const UnsignedInteger b = partner[a];
+      if (b == size) continue;
+      const Scalar step = normalized(b, i) - normalized(a, i);
+      ++pairsNumber_[i];
+      const Scalar weight = 1.0 / pairsNumber_[i];
+      for (UnsignedInteger j = 0; j < outputDimension; ++j)
+      {
+        const UnsignedInteger index = i + j * inputDimension;
+        const Scalar effect = (outputSample_(b, j) - outputSample_(a, j)) / step;
+        UpdateStatistics(effect, weight, mean[index], absoluteMean[index], squaredDeviations[index]);
+      }
+    }
+    if (pairsNumber_[i] == 0)
+      Log::Warn(OSS() << "In MorrisDatabase, no pair found for input " << i << " with tolerance=" << tolerance_);
+    Log::Info(OSS() << "Input " << i << ": " << pairsNumber_[i] << " pairs");
+  } // end for i
+  setStatistics(mean, absoluteMean, squaredDeviations, pairsNumber_);
+}
+
+/* Number of pairs used for each input */
+Indices MorrisDatabase::getPairsNumber() const
+{
+  return pairsNumber_;
+}
+
+/* Tolerance accessor */
+Scalar MorrisDatabase::getTolerance() const
+{
+  return tolerance_;
+}
+
+/* String converter */
+String MorrisDatabase::__repr__() const
+{
+  OSS oss;
+  oss << "class=" << MorrisDatabase::GetClassName()
+      << ", tolerance=" << tolerance_
+      << ", pairs number=" << pairsNumber_
+      << ", ee mean= " << elementaryEffectsMean_
+      << ", absolute ee mean= " << absoluteElementaryEffectsMean_
+      << ", ee std= " << elementaryEffectsStandardDeviation_;
+  return oss;
+}
+
+/* Method save() stores the object through the StorageManager */
+void MorrisDatabase::save(Advocate & adv) const
+{
+  Morris::save( adv );
+  adv.saveAttribute( "tolerance_", tolerance_ );
+  adv.saveAttribute( "pairsNumber_", pairsNumber_ );
+}
+
+/* Method load() reloads the object from the StorageManager */
+void MorrisDatabase::load(Advocate & adv)
+{
+  Morris::load( adv );
+  adv.loadAttribute( "tolerance_", tolerance_ );
+  adv.loadAttribute( "pairsNumber_", pairsNumber_ );
+}
+
+
+} /* namespace OTMORRIS */
@@ -0,0 +1,307 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief MorrisEnsemble
+ *
+ *  Copyright 2005-2024 Airbus-EDF-IMACS-Phimeca
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+ *
+ */
+#include "otmorris/MorrisEnsemble.hxx"
+
+#include <openturns/PersistentObjectFactory.hxx>
+#include <openturns/RandomGenerator.hxx>
+#include <openturns/RandomGeneratorState.hxx>
+#include <openturns/TBBImplementation.hxx>
+#include <openturns/Log.hxx>
+
+using namespace OT;
+
+namespace OTMORRIS
+{
+
+CLASSNAMEINIT(MorrisEnsemble)
+
+static const Factory<MorrisEnsemble> Factory_MorrisEnsemble;
+
+/** Default constructor */
+MorrisEnsemble::MorrisEnsemble()
+  : PersistentObject()
+  , savedCallsNumber_(0)
+{}
+
+/** Standard constructor with experiment, model and number of replicates */
+MorrisEnsemble::MorrisEnsemble(const MorrisExperiment & experiment, const Function & model, const UnsignedInteger replicatesNumber)
+  : PersistentObject()
+  , inputSample_()
+  , outputSample_()
+  , interval_(experiment.getBounds())
+  , seeds_(replicatesNumber)
+  , elementaryEffectsMeanSample_()
+  , elementaryEffectsStandardDeviationSample_()
+  , absoluteElementaryEffectsMeanSample_()
+  , savedCallsNumber_(0)
+{
+  if (replicatesNumber == 0)
+    throw InvalidArgumentException(HERE) << "In MorrisEnsemble::MorrisEnsemble, the number of replicates should be positive";
+  if (experiment.getSize() == 0)
+    throw InvalidArgumentException(HERE) << "In MorrisEnsemble::MorrisEnsemble, samples should not be empty";
+  const UnsignedInteger inputDimension = interval_.getDimension();
+  if (model.getInputDimension() != inputDimension)
+    throw InvalidArgumentException(HERE) << "In MorrisEnsemble::MorrisEnsemble, model should have the same input dimension as the experiment. Here, experiment's dimension=" << inputDimension
+                                         << ", model's input dimension=" << model.getInputDimension();
+
+  // Distinct seeds, each one keys an independent sharded design
+  const UnsignedInteger firstSeed = RandomGenerator::IntegerGenerate(static_cast<UnsignedInteger>(1) << 31);
+  for (UnsignedInteger r = 0; r < replicatesNumber; ++r)
+    seeds_[r] = firstSeed + r;
+  inputSample_ = Sample(0, inputDimension);
+  if (experiment.isShardable())
+  {
+    for (UnsignedInteger r = 0; r < replicatesNumber; ++r)
+      inputSample_.add(experiment.generateShard(0, 1, seeds_[r]));
+  }
+  else
+  {
+    // Too few starting points for distinct sharded trajectories (small LHS designs):
+    // the designs are generated as in Morris, each one from its seed
+    Log::Info(OSS() << "In MorrisEnsemble::MorrisEnsemble, cannot generate sharded designs, use generate() instead");
+    const RandomGeneratorState initialState(RandomGenerator::GetState());
+    for (UnsignedInteger r = 0; r < replicatesNumber; ++r)
+    {
+      RandomGenerator::SetSeed(seeds_[r]);
+      inputSample_.add(experiment.generate());
+    }
+    RandomGenerator::SetState(initialState);
+  }
+  inputSample_.setDescription(model.getInputDescription());
+
+  // Single evaluation of all the designs, so that vectorized
+  // or parallel models get the full batch
+  // Points shared by several trajectories or replicates are evaluated once
+  Log::Info(OSS() << "In MorrisEnsemble::MorrisEnsemble, evaluate " << replicatesNumber << " replicates of size " << inputSample_.getSize() / replicatesNumber);
+  outputSample_ = Morris::EvaluateDistinctPoints(model, inputSample_, interval_, savedCallsNumber_);
+
+  // Perform evaluation of elementary effects
+  computeReplicates();
+}
+
+/* Virtual constructor method */
+MorrisEnsemble * MorrisEnsemble::clone() const
+{
+  return new MorrisEnsemble(*this);
+}
+
+struct MorrisEnsemblePolicy
+{
+  const Sample & inputSample_;
+  const Sample & outputSample_;
+  const Interval & interval_;
+  const UnsignedInteger replicateSize_;
+  const UnsignedInteger effectsDimension_;
+  Scalar * const mean_;
+  Scalar * const absoluteMean_;
+  Scalar * const standardDeviation_;
+
+  MorrisEnsemblePolicy(const Sample & inputSample,
+                       const Sample & outputSample,
+                       const Interval & interval,
+                       const UnsignedInteger replicateSize,
+                       const UnsignedInteger effectsDimension,
+                       Scalar * const mean,
+                       Scalar * const absoluteMean,
+                       Scalar * const standardDeviation)
+    : inputSample_(inputSample)
+    , outputSample_(outputSample)
+    , interval_(interval)
+    , replicateSize_(replicateSize)
+    , effectsDimension_(effectsDimension)
+    , mean_(mean)
+    , absoluteMean_(absoluteMean)
+    , standardDeviation_(standardDeviation)
+  {}
+
+  inline void operator()(const TBBImplementation::BlockedRange<UnsignedInteger> & r) const
+  {
+    const UnsignedInteger inputDimension = inputSample_.getDimension();
+    for (UnsignedInteger i = r.begin(); i != r.end(); ++i)
+    {
+      const UnsignedInteger first = i * replicateSize_;
+      const Morris replicate(Sample(inputSample_, first, first + replicateSize_), Sample(outputSample_, first, first + replicateSize_), interval_);
+      // Each replicate writes its own row of the statistics
+      for (UnsignedInteger j = 0; j < outputSample_.getDimension(); ++j)
+      {
+        const Point mean(replicate.getMeanElementaryEffects(j));
+        const Point absoluteMean(replicate.getMeanAbsoluteElementaryEffects(j));
+        const Point standardDeviation(replicate.getStandardDeviationElementaryEffects(j));
+        for (UnsignedInteger k = 0; k < inputDimension; ++k)
+        {
+          const UnsignedInteger index = i * effectsDimension_ + k + j * inputDimension;
+          mean_[index] = mean[k];
+          absoluteMean_[index] = absoluteMean[k];
+          standardDeviation_[index] = standardDeviation[k];
+        }
+      }
+    }
+  }
+}; /* end struct MorrisEnsemblePolicy */
+
+// Method that computes the statistics of all the replicates
+void MorrisEnsemble::computeReplicates()
+{
+  const UnsignedInteger replicatesNumber = seeds_.getSize();
+  const UnsignedInteger effectsDimension = inputSample_.getDimension() * outputSample_.getDimension();
+  elementaryEffectsMeanSample_ = Sample(replicatesNumber, effectsDimension);
+  absoluteElementaryEffectsMeanSample_ = Sample(replicatesNumber, effectsDimension);
+  elementaryEffectsStandardDeviationSample_ = Sample(replicatesNumber, effectsDimension);
+  // The replicates are independent, they are computed in parallel
+  const MorrisEnsemblePolicy policy(inputSample_, outputSample_, interval_,
+                                    inputSample_.getSize() / replicatesNumber, effectsDimension,
+                                    &elementaryEffectsMeanSample_(0, 0),
+                                    &absoluteElementaryEffectsMeanSample_(0, 0),
+                                    &elementaryEffectsStandardDeviationSample_(0, 0));
+  TBBImplementation::ParallelFor(0, replicatesNumber, policy);
+}
+
+/* Number of replicates accessor */
+UnsignedInteger MorrisEnsemble::getReplicatesNumber() const
+{
+  return seeds_.getSize();
+}
+
+/* Seeds of the designs accessor */
+Indices MorrisEnsemble::getSeeds() const
+{
+  return seeds_;
+}
+
+/* Morris screening of a replicate */
+Morris MorrisEnsemble::getReplicate(const UnsignedInteger index) const
+{
+  const UnsignedInteger replicatesNumber = seeds_.getSize();
+  if (index >= replicatesNumber) throw InvalidArgumentException(HERE) << "In MorrisEnsemble::getReplicate, index=" << index << " should be lesser than the number of replicates=" << replicatesNumber;
+  const UnsignedInteger replicateSize = inputSample_.getSize() / replicatesNumber;
+  const UnsignedInteger first = index * replicateSize;
+  return Morris(Sample(inputSample_, first, first + replicateSize), Sample(outputSample_, first, first + replicateSize), interval_);
+}
+
+// Columns of an output marginal in a statistics sample
+Sample MorrisEnsemble::getMarginalStatistics(const Sample & statistics, const UnsignedInteger outputMarginal) const
+{
+  if (outputMarginal >= outputSample_.getDimension()) throw InvalidArgumentException(HERE) << "Cannot exceed dimension";
+  const UnsignedInteger inputDimension = inputSample_.getDimension();
+  Indices indices(inputDimension);
+  indices.fill(outputMarginal * inputDimension);
+  Sample result(statistics.getMarginal(indices));
+  result.setDescription(inputSample_.getDescription());
+  return result;
+}
+
+/* Mean absolute effects of each replicate */
+Sample MorrisEnsemble::getMeanAbsoluteElementaryEffectsSample(const UnsignedInteger outputMarginal) const
+{
+  return getMarginalStatistics(absoluteElementaryEffectsMeanSample_, outputMarginal);
+}
+
+/* Mean effects of each replicate */
+Sample MorrisEnsemble::getMeanElementaryEffectsSample(const UnsignedInteger outputMarginal) const
+{
+  return getMarginalStatistics(elementaryEffectsMeanSample_, outputMarginal);
+}
+
+/* Standard deviation effects of each replicate */
+Sample MorrisEnsemble::getStandardDeviationElementaryEffectsSample(const UnsignedInteger outputMarginal) const
+{
+  return getMarginalStatistics(elementaryEffectsStandardDeviationSample_, outputMarginal);
+}
+
+/* Spread of the mean absolute effects */
+Point MorrisEnsemble::getMeanAbsoluteElementaryEffectsSpread(const UnsignedInteger outputMarginal) const
+{
+  return getMeanAbsoluteElementaryEffectsSample(outputMarginal).computeStandardDeviation();
+}
+
+/* Spread of the mean effects */
+Point MorrisEnsemble::getMeanElementaryEffectsSpread(const UnsignedInteger outputMarginal) const
+{
+  return getMeanElementaryEffectsSample(outputMarginal).computeStandardDeviation();
+}
+
+/* Spread of the standard deviation effects */
+Point MorrisEnsemble::getStandardDeviationElementaryEffectsSpread(const UnsignedInteger outputMarginal) const
+{
+  return getStandardDeviationElementaryEffectsSample(outputMarginal).computeStandardDeviation();
+}
+
+/* Number of model evaluations saved by removing duplicated design points */
+UnsignedInteger MorrisEnsemble::getSavedCallsNumber() const
+{
+  return savedCallsNumber_;
+}
+
+Sample MorrisEnsemble::getInputSample() const
+{
+  return inputSample_;
+}
+
+Sample MorrisEnsemble::getOutputSample() const
+{
+  return outputSample_;
+}
+
+/* String converter */
+String MorrisEnsemble::__repr__() const
+{
+  OSS oss;
+  oss << "class=" << MorrisEnsemble::GetClassName()
+      << ", replicates number=" << seeds_.getSize()
+      << ", seeds=" << seeds_
+      << ", ee mean= " << elementaryEffectsMeanSample_
+      << ", absolute ee mean= " << absoluteElementaryEffectsMeanSample_
+      << ", ee std= " << elementaryEffectsStandardDeviationSample_;
+  return oss;
+}
+
+/* Method save() stores the object through the StorageManager */
+void MorrisEnsemble::save(Advocate & adv) const
+{
+  PersistentObject::save( adv );
+  // Statistics first, then the bulk samples
+  adv.saveAttribute( "seeds_", seeds_ );
+  adv.saveAttribute( "elementaryEffectsMeanSample_", elementaryEffectsMeanSample_ );
+  adv.saveAttribute( "elementaryEffectsStandardDeviationSample_", elementaryEffectsStandardDeviationSample_ );
+  adv.saveAttribute( "absoluteElementaryEffectsMeanSample_", absoluteElementaryEffectsMeanSample_ );
+  adv.saveAttribute( "interval_", interval_ );
+  adv.saveAttribute( "savedCallsNumber_", savedCallsNumber_ );
+  adv.saveAttribute( "inputSample_", inputSample_ );
+  adv.saveAttribute( "outputSample_", outputSample_ );
+}
+
+/* Method load() reloads the object from the StorageManager */
+void MorrisEnsemble::load(Advocate & adv)
+{
+  PersistentObject::load( adv );
+  adv.loadAttribute( "seeds_", seeds_ );
+  adv.loadAttribute( "elementaryEffectsMeanSample_", elementaryEffectsMeanSample_ );
+  adv.loadAttribute( "elementaryEffectsStandardDeviationSample_", elementaryEffectsStandardDeviationSample_ );
+  adv.loadAttribute( "absoluteElementaryEffectsMeanSample_", absoluteElementaryEffectsMeanSample_ );
+  adv.loadAttribute( "interval_", interval_ );
+  adv.loadAttribute( "savedCallsNumber_", savedCallsNumber_ );
+  adv.loadAttribute( "inputSample_", inputSample_ );
+  adv.loadAttribute( "outputSample_", outputSample_ );
+}
+
+
+} /* namespace OTMORRIS */
@@ -22,8 +22,11 @@
 #include <openturns/PersistentObjectFactory.hxx>
 #include "otmorris/MorrisExperiment.hxx"
 #include <openturns/KPermutationsDistribution.hxx>
+#include <openturns/RandomGenerator.hxx>
+#include <openturns/RandomGeneratorState.hxx>
 #include <openturns/Exception.hxx>
 #include <openturns/Log.hxx>
+#include <cstdint>
 
 using namespace OT;
 
@@ -86,6 +89,104 @@ Sample MorrisExperiment::generate() const
   throw NotYetImplementedException(HERE) << "in MorrisExperiment::generate";
 }
 
+/** Whether the design has enough starting points for sharded generation */
+Bool MorrisExperiment::isShardable() const
+{
+  // Trajectory k starts from the point of index permutation(k mod P) among the P available ones
+  // Trajectories sharing their starting point (k / P differs) move first along different axes,
+  // so that all the trajectories of the design are distinct as long as each
+  // starting point is shared by at most dimension trajectories
+  const UnsignedInteger dimension = delta_.getDimension();
+  return (N_ + dimension - 1) / dimension <= getStartingPointsNumber();
+}
+
+/** Generate the trajectories of one shard of the design */
+Sample MorrisExperiment::generateShard(const UnsignedInteger shardIndex, const UnsignedInteger shardNumber, const UnsignedInteger seed) const
+{
+  if (shardNumber == 0)
+    throw InvalidArgumentException(HERE) << "In MorrisExperiment::generateShard, the number of shards should be positive";
+  if (shardIndex >= shardNumber)
+    throw InvalidArgumentException(HERE) << "In MorrisExperiment::generateShard, shard index=" << shardIndex
+                                         << " should be lesser than the number of shards=" << shardNumber;
+  const UnsignedInteger dimension = delta_.getDimension();
+  const UnsignedInteger startingPointsNumber = getStartingPointsNumber();
+  if (!isShardable())
+    throw InvalidArgumentException(HERE) << "In MorrisExperiment::generateShard, cannot generate " << N_ << " distinct trajectories from "
+                                         << startingPointsNumber << " starting points in dimension " << dimension;
+  // Trajectories of the shard
+  const UnsignedInteger first = (shardIndex * N_) / shardNumber;
+  const UnsignedInteger last = ((shardIndex + 1) * N_) / shardNumber;
+  Log::Info(OSS() << "Generate trajectories " << first << " to " << last << " of shard " << shardIndex << "/" << shardNumber);
+  // Each trajectory is generated from its own seed, the state of the generator is restored afterwards
+  const RandomGeneratorState initialState(RandomGenerator::GetState());
+  Sample realizations(0, dimension);
+  try
+  {
+    for (UnsignedInteger k = first; k < last; ++k)
+    {
+      const UnsignedInteger startingPoint = PermuteIndex(k % startingPointsNumber, startingPointsNumber, seed);
+      const UnsignedInteger firstAxis = (HashIndex(startingPoint, seed) + k / startingPointsNumber) % dimension;
+      RandomGenerator::SetSeed(HashIndex(k, HashIndex(seed, 0)) & 0xffffffffUL);
+      realizations.add(generateShardTrajectory(startingPoint, firstAxis));
+    }
+  }
+  catch (...)
+  {
+    RandomGenerator::SetState(initialState);
+    throw;
+  }
+  RandomGenerator::SetState(initialState);
+  return realizations;
+}
+
+/* Number of distinct starting points available for sharded generation */
+UnsignedInteger MorrisExperiment::getStartingPointsNumber() const
+{
+  throw NotYetImplementedException(HERE) << "in MorrisExperiment::getStartingPointsNumber";
+}
+
+/* Generate the trajectory of a shard given its starting point and first axis */
+Sample MorrisExperiment::generateShardTrajectory(const UnsignedInteger, const UnsignedInteger) const
+{
+  throw NotYetImplementedException(HERE) << "in MorrisExperiment::generateShardTrajectory";
+}
+
+/* Hash of an index, keyed by a seed (splitmix64 finalizer) */
+UnsignedInteger MorrisExperiment::HashIndex(const UnsignedInteger index, const UnsignedInteger seed)
+{
+  uint64_t z = static_cast<uint64_t>(seed) * 0x9e3779b97f4a7c15ULL + static_cast<uint64_t>(index) + 0x9e3779b97f4a7c15ULL;
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  return static_cast<UnsignedInteger>(z ^ (z >> 31));
+}
+
+/* Pseudo-random permutation of {0,...,size-1}, keyed by a seed */
+UnsignedInteger MorrisExperiment::PermuteIndex(const UnsignedInteger index, const UnsignedInteger size, const UnsignedInteger seed)
+{
+  if (index >= size)
+    throw InvalidArgumentException(HERE) << "In MorrisExperiment::PermuteIndex, index=" << index << " should be lesser than size=" << size;
+  // Bijection on [0, 2^m) with 2^m >= size, made of keyed additions,
+  // odd multiplications and xorshifts, then cycle-walking until the
+  // image falls into [0, size)
+  UnsignedInteger bitsNumber = 0;
+  while ((static_cast<uint64_t>(1) << bitsNumber) < static_cast<uint64_t>(size)) ++bitsNumber;
+  if (bitsNumber == 0) return 0;
+  const uint64_t mask = (bitsNumber >= 64) ? ~static_cast<uint64_t>(0) : ((static_cast<uint64_t>(1) << bitsNumber) - 1);
+  const UnsignedInteger shift = (bitsNumber + 1) / 2;
+  uint64_t value = index;
+  do
+  {
+    for (UnsignedInteger round = 0; round < 4; ++round)
+    {
+      value = (value + static_cast<uint64_t>(HashIndex(round, seed))) & mask;
+      value = (value * 0x9e3779b97f4a7c15ULL) & mask;
+      value ^= value >> shift;
+    }
+  }
+  while (value >= static_cast<uint64_t>(size));
+  return static_cast<UnsignedInteger>(value);
+}
+
 /* String converter */
 String MorrisExperiment::__repr__() const
 {
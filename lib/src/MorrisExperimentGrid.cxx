@@ -25,6 +25,8 @@
 #include <openturns/KPermutationsDistribution.hxx>
 #include <openturns/RandomGenerator.hxx>
 #include <openturns/Log.hxx>
+#include <limits>
+#include <utility>
 #if OPENTURNS_VERSION >= 102700
 #include <openturns/FiniteDiscreteDistribution.hxx>
 #else
@@ -113,6 +115,25 @@ Sample MorrisExperimentGrid::generateTrajectory() const
   const UnsignedInteger dimension = delta_.getDimension();
   // Distribution that defines the permutations
   const KPermutationsDistribution permutationDistribution(dimension, dimension);
+
+  // First generate points from regular grid U(0,1)^d
+  Indices start(dimension);
+  for (UnsignedInteger p = 0; p < dimension; ++p)
+  {
+    const UnsignedInteger level = static_cast<UnsignedInteger>(1.0 + 1.0 / delta_[p]);
+    start[p] = RandomGenerator::IntegerGenerate(level - jumpStep_[p]);
+  }
+  Log::Info(OSS() << "Generated node = " << start);
+
+  // Define the permutations
+  const Point permutations(permutationDistribution.getRealization());
+  Log::Debug(OSS() << "Permutation generated = " << permutations);
+  return generateTrajectory(start, permutations);
+}
+
+Sample MorrisExperimentGrid::generateTrajectory(const Indices & start, const Point & permutations) const
+{
+  const UnsignedInteger dimension = delta_.getDimension();
   // Distribution that defines the direction
   Sample admissibleDirections(2, 1);
   admissibleDirections(0, 0) =  -1.0;
@@ -128,18 +149,11 @@ Sample MorrisExperimentGrid::generateTrajectory() const
   // Scaling delta
   for(UnsignedInteger k = 0; k < dimension; ++k) delta[k] *= jumpStep_[k];
 
-  // First generate points from regular grid U(0,1)^d
+  // Starting point from regular grid U(0,1)^d
   Point xBase(dimension, 0.0);
   for (UnsignedInteger p = 0; p < dimension; ++p)
-  {
-    const UnsignedInteger level = static_cast<UnsignedInteger>(1.0 + 1.0 / delta_[p]);
-    xBase[p] = delta_[p] * RandomGenerator::IntegerGenerate(level - jumpStep_[p]);
-  }
-  Log::Info(OSS() << "Generated point = " << xBase);
+    xBase[p] = delta_[p] * start[p];
 
-  // Define the permutations
-  const Point permutations(permutationDistribution.getRealization());
-  Log::Debug(OSS() << "Permutation generated = " << permutations);
   // Define the direction
   const Point directions(directionDistribution.getSample(dimension).getImplementation()->getData());
   Log::Debug(OSS() << "directions = " << directions);
@@ -168,6 +182,53 @@ Sample MorrisExperimentGrid::generateTrajectory() const
   return path;
 }
 
+/* Number of distinct starting points available for sharded generation */
+UnsignedInteger MorrisExperimentGrid::getStartingPointsNumber() const
+{
+  // Product of the numbers of starting nodes along the axes, skipping
+  // the axes that would overflow: their node is drawn at random
+  const UnsignedInteger maximumSize = std::numeric_limits<UnsignedInteger>::max() >> 2;
+  UnsignedInteger startingPointsNumber = 1;
+  for (UnsignedInteger p = 0; p < delta_.getDimension(); ++p)
+  {
+    const UnsignedInteger level = static_cast<UnsignedInteger>(1.0 + 1.0 / delta_[p]);
+    const UnsignedInteger nodesNumber = level - jumpStep_[p];
+    if (startingPointsNumber <= maximumSize / nodesNumber)
+      startingPointsNumber *= nodesNumber;
+  }
+  return startingPointsNumber;
+}
+
+/* Generate the trajectory of a shard given its starting point and first axis */
+Sample MorrisExperimentGrid::generateShardTrajectory(const UnsignedInteger startingPoint, const UnsignedInteger firstAxis) const
+{
+  const UnsignedInteger dimension = delta_.getDimension();
+  // Decode the starting point in mixed radix, consistently with getStartingPointsNumber
+  const UnsignedInteger maximumSize = std::numeric_limits<UnsignedInteger>::max() >> 2;
+  UnsignedInteger startingPointsNumber = 1;
+  UnsignedInteger remainder = startingPoint;
+  Indices start(dimension);
+  for (UnsignedInteger p = 0; p < dimension; ++p)
+  {
+    const UnsignedInteger level = static_cast<UnsignedInteger>(1.0 + 1.0 / delta_[p]);
+    const UnsignedInteger nodesNumber = level - jumpStep_[p];
+    if (startingPointsNumber <= maximumSize / nodesNumber)
+    {
+      start[p] = remainder % nodesNumber;
+      remainder /= nodesNumber;
+      startingPointsNumber *= nodesNumber;
+    }
+    else
+      start[p] = RandomGenerator::IntegerGenerate(nodesNumber);
+  }
+  // Random permutation of the axes, starting with firstAxis
+  Point permutations(KPermutationsDistribution(dimension, dimension).getRealization());
+  for (UnsignedInteger i = 1; i < dimension; ++i)
+    if (static_cast<UnsignedInteger>(permutations[i]) == firstAxis)
+      std::swap(permutations[0], permutations[i]);
+  return generateTrajectory(start, permutations);
+}
+
 /** get/set jumpStep */
 Indices MorrisExperimentGrid::getJumpStep() const
 {
@@ -24,6 +24,7 @@
 #include <openturns/KPermutationsDistribution.hxx>
 #include <openturns/RandomGenerator.hxx>
 #include <openturns/Log.hxx>
+#include <utility>
 #if OPENTURNS_VERSION >= 102700
 #include <openturns/FiniteDiscreteDistribution.hxx>
 #else
@@ -129,6 +130,13 @@ Sample MorrisExperimentLHS::generateTrajectory(const UnsignedInteger index) cons
   const KPermutationsDistribution permutationDistribution(dimension, dimension);
   // Define the permutations
   const Point permutations(permutationDistribution.getRealization());
+  return generateTrajectory(index, permutations);
+}
+
+/** Generate 1 trajectory given the permutation of the axes */
+Sample MorrisExperimentLHS::generateTrajectory(const UnsignedInteger index, const Point & permutations) const
+{
+  const UnsignedInteger dimension(delta_.getDimension());
   // Distribution that defines the direction
   Sample admissibleDirections(2, 1);
   admissibleDirections(0, 0) = 1.0;
@@ -174,6 +182,24 @@ Sample MorrisExperimentLHS::generateTrajectory(const UnsignedInteger index) cons
 }
 
 
+/* Number of distinct starting points available for sharded generation */
+UnsignedInteger MorrisExperimentLHS::getStartingPointsNumber() const
+{
+  return experiment_.getSize();
+}
+
+/* Generate the trajectory of a shard given its starting point and first axis */
+Sample MorrisExperimentLHS::generateShardTrajectory(const UnsignedInteger startingPoint, const UnsignedInteger firstAxis) const
+{
+  const UnsignedInteger dimension(delta_.getDimension());
+  // Random permutation of the axes, starting with firstAxis
+  Point permutations(KPermutationsDistribution(dimension, dimension).getRealization());
+  for (UnsignedInteger i = 1; i < dimension; ++i)
+    if (static_cast<UnsignedInteger>(permutations[i]) == firstAxis)
+      std::swap(permutations[0], permutations[i]);
+  return generateTrajectory(startingPoint, permutations);
+}
+
 /* String converter */
 String MorrisExperimentLHS::__repr__() const
 {
@@ -0,0 +1,284 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief MorrisPrincipalComponents
+ *
+ *  Copyright 2005-2024 Airbus-EDF-IMACS-Phimeca
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+ *
+ */
+#include "otmorris/MorrisPrincipalComponents.hxx"
+
+#include <openturns/PersistentObjectFactory.hxx>
+#include <openturns/DistFunc.hxx>
+#include <openturns/RandomGenerator.hxx>
+#include <openturns/RandomGeneratorState.hxx>
+#include <openturns/Log.hxx>
+#include <algorithm>
+#include <cmath>
+
+using namespace OT;
+
+namespace OTMORRIS
+{
+
+CLASSNAMEINIT(MorrisPrincipalComponents)
+
+static const Factory<MorrisPrincipalComponents> Factory_MorrisPrincipalComponents;
+
+/** Default constructor */
+MorrisPrincipalComponents::MorrisPrincipalComponents()
+  : Morris()
+  , componentsNumber_(0)
+  , basis_()
+  , outputMean_()
+  , eigenValues_()
+{}
+
+/** Standard constructor with in/out designs and number of components */
+MorrisPrincipalComponents::MorrisPrincipalComponents(const Sample & inputSample, const Sample & outputSample, const Interval & interval, const UnsignedInteger componentsNumber)
+  : Morris()
+  , componentsNumber_(componentsNumber)
+  , basis_()
+  , outputMean_()
+  , eigenValues_()
+{
+  const UnsignedInteger size = inputSample.getSize();
+  if (outputSample.getSize() != size)
+    throw InvalidArgumentException(HERE) << "In MorrisPrincipalComponents::MorrisPrincipalComponents, input & output samples should be of same size. Here, input sample's size=" << size
+                                         << ", output sample's size=" << outputSample.getSize();
+  if (size == 0)
+    throw InvalidArgumentException(HERE) << "In MorrisPrincipalComponents::MorrisPrincipalComponents, samples should not be empty";
+  const UnsignedInteger inputDimension = inputSample.getDimension();
+  const UnsignedInteger N = static_cast<UnsignedInteger>(size / (inputDimension + 1));
+  if (size != N * (inputDimension + 1))
+    throw InvalidArgumentException(HERE) << "In MorrisPrincipalComponents::MorrisPrincipalComponents, sample size should be a multiple of " << inputDimension + 1;
+  if ((componentsNumber == 0) || (componentsNumber > std::min(size, outputSample.getDimension())))
+    throw InvalidArgumentException(HERE) << "In MorrisPrincipalComponents::MorrisPrincipalComponents, components number should be between 1 and " << std::min(size, outputSample.getDimension())
+                                         << ", here components number=" << componentsNumber;
+  inputSample_ = inputSample;
+  interval_ = interval;
+  // Only the scores are kept, the elementary effects are computed on k outputs instead of q
+  outputSample_ = computePrincipalComponents(outputSample);
+  // Perform evaluation of elementary effects
+  computeEffects(N);
+}
+
+/* Virtual constructor method */
+MorrisPrincipalComponents * MorrisPrincipalComponents::clone() const
+{
+  return new MorrisPrincipalComponents(*this);
+}
+
+// Randomized SVD of the centered output sample, returns the scores
+Sample MorrisPrincipalComponents::computePrincipalComponents(const Sample & outputSample)
+{
+  const UnsignedInteger size = outputSample.getSize();
+  const UnsignedInteger dimension = outputSample.getDimension();
+  // Oversampling and power iterations of the range finder (Halko et al., 2011)
+  const UnsignedInteger oversamplingNumber = 10;
+  const UnsignedInteger powerIterationsNumber = 2;
+  const UnsignedInteger sketchDimension = std::min(std::min(size, dimension), componentsNumber_ + oversamplingNumber);
+  outputMean_ = outputSample.computeMean();
+  // Orthonormal basis of the range of the centered sample, each product is
+  // a single pass over the sample and the centered sample is never stored
+  // The sketch is drawn from the current state of the generator, which is
+  // then restored so that the random stream of the caller is left untouched
+  const RandomGeneratorState initialState(RandomGenerator::GetState());
+  const Matrix gaussian(dimension, sketchDimension, DistFunc::rNormal(dimension * sketchDimension));
+  RandomGenerator::SetState(initialState);
+  Matrix sketch(MultiplyCentered(outputSample, outputMean_, gaussian));
+  Matrix triangular;
+  Matrix range(sketch.computeQR(triangular));
+  for (UnsignedInteger iteration = 0; iteration < powerIterationsNumber; ++iteration)
+  {
+    Matrix transposedSketch(MultiplyCenteredTransposed(outputSample, outputMean_, range));
+    const Matrix transposedRange(transposedSketch.computeQR(triangular));
+    sketch = MultiplyCentered(outputSample, outputMean_, transposedRange);
+    range = sketch.computeQR(triangular);
+  }
+  // The left singular vectors of the small q x l matrix Yc^T Q are the principal directions
+  Matrix projected(MultiplyCenteredTransposed(outputSample, outputMean_, range));
+  Matrix u;
+  Matrix vT;
+  const Point singularValues(projected.computeSVD(u, vT, false));
+  basis_ = Matrix(dimension, componentsNumber_);
+  eigenValues_ = Point(componentsNumber_);
+  for (UnsignedInteger k = 0; k < componentsNumber_; ++k)
+  {
+    // Sign convention: the largest component of each direction is positive
+    UnsignedInteger argMax = 0;
+    for (UnsignedInteger j = 1; j < dimension; ++j)
+      if (std::abs(u(j, k)) > std::abs(u(argMax, k))) argMax = j;
+    const Scalar sign = (u(argMax, k) < 0.0) ? -1.0 : 1.0;
+    for (UnsignedInteger j = 0; j < dimension; ++j)
+      basis_(j, k) = sign * u(j, k);
+    eigenValues_[k] = singularValues[k] * singularValues[k] / (size - 1.0);
+  }
+  Log::Info(OSS() << "In MorrisPrincipalComponents, eigen values=" << eigenValues_);
+  // Scores of the sample
+  const Matrix scores(MultiplyCentered(outputSample, outputMean_, basis_));
+  Sample result(size, componentsNumber_);
+  for (UnsignedInteger i = 0; i < size; ++i)
+    for (UnsignedInteger k = 0; k < componentsNumber_; ++k)
+      result(i, k) = scores(i, k);
+  result.setDescription(Description::BuildDefault(componentsNumber_, "pc"));
+  return result;
+}
+
+// Product of the centered sample by a matrix, one row at a time
+Matrix MorrisPrincipalComponents::MultiplyCentered(const Sample & sample, const Point & mean, const Matrix & matrix)
+{
+  const UnsignedInteger size = sample.getSize();
+  const UnsignedInteger dimension = sample.getDimension();
+  const UnsignedInteger columnsNumber = matrix.getNbColumns();
+  Matrix result(size, columnsNumber);
+  // Matrices are stored by columns
+  const Scalar * const matrixData = &(*matrix.getImplementation())[0];
+  Scalar * const resultData = &(*result.getImplementation())[0];
+  Point centered(dimension);
+  for (UnsignedInteger i = 0; i < size; ++i)
+  {
+    const Scalar * const row = &sample(i, 0);
+    for (UnsignedInteger j = 0; j < dimension; ++j)
+      centered[j] = row[j] - mean[j];
+    for (UnsignedInteger k = 0; k < columnsNumber; ++k)
+    {
+      const Scalar * const column = matrixData + k * dimension;
+      Scalar value = 0.0;
+      for (UnsignedInteger j = 0; j < dimension; ++j)
+        value += centered[j] * column[j];
+      resultData[i + k * size] = value;
+    }
+  }
+  return result;
+}
+
+// Product of the transposed centered sample by a matrix, one row at a time
+Matrix MorrisPrincipalComponents::MultiplyCenteredTransposed(const Sample & sample, const Point & mean, const Matrix & matrix)
+{
+  const UnsignedInteger size = sample.getSize();
+  const UnsignedInteger dimension = sample.getDimension();
+  const UnsignedInteger columnsNumber = matrix.getNbColumns();
+  Matrix result(dimension, columnsNumber);
+  const Scalar * const matrixData = &(*matrix.getImplementation())[0];
+  Scalar * const resultData = &(*result.getImplementation())[0];
+  Point centered(dimension);
+  for (UnsignedInteger i = 0; i < size; ++i)
+  {
+    const Scalar * const row = &sample(i, 0);
+    for (UnsignedInteger j = 0; j < dimension; ++j)
+      centered[j] = row[j] - mean[j];
+    for (UnsignedInteger k = 0; k < columnsNumber; ++k)
+    {
+      const Scalar factor = matrixData[i + k * size];
+      Scalar * const column = resultData + k * dimension;
+      for (UnsignedInteger j = 0; j < dimension; ++j)
+        column[j] += factor * centered[j];
+    }
+  }
+  return result;
+}
+
+// Euclidean norm over the components of each input
+Point MorrisPrincipalComponents::ComputeColumnNorms(const Sample & statistics)
+{
+  const UnsignedInteger inputDimension = statistics.getDimension();
+  Point result(inputDimension);
+  for (UnsignedInteger k = 0; k < statistics.getSize(); ++k)
+    for (UnsignedInteger i = 0; i < inputDimension; ++i)
+      result[i] += statistics(k, i) * statistics(k, i);
+  for (UnsignedInteger i = 0; i < inputDimension; ++i)
+    result[i] = std::sqrt(result[i]);
+  return result;
+}
+
+/* Generalized mean of absolute effects */
+Point MorrisPrincipalComponents::getGeneralizedMeanAbsoluteElementaryEffects() const
+{
+  return ComputeColumnNorms(absoluteElementaryEffectsMean_);
+}
+
+/* Generalized mean effects */
+Point MorrisPrincipalComponents::getGeneralizedMeanElementaryEffects() const
+{
+  return ComputeColumnNorms(elementaryEffectsMean_);
+}
+
+/* Generalized standard deviation effects */
+Point MorrisPrincipalComponents::getGeneralizedStandardDeviationElementaryEffects() const
+{
+  return ComputeColumnNorms(elementaryEffectsStandardDeviation_);
+}
+
+/* Number of components accessor */
+UnsignedInteger MorrisPrincipalComponents::getComponentsNumber() const
+{
+  return componentsNumber_;
+}
+
+/* Principal directions accessor */
+Matrix MorrisPrincipalComponents::getBasis() const
+{
+  return basis_;
+}
+
+/* Mean of the output sample accessor */
+Point MorrisPrincipalComponents::getOutputMean() const
+{
+  return outputMean_;
+}
+
+/* Variance of the components accessor */
+Point MorrisPrincipalComponents::getEigenValues() const
+{
+  return eigenValues_;
+}
+
+/* String converter */
+String MorrisPrincipalComponents::__repr__() const
+{
+  OSS oss;
+  oss << "class=" << MorrisPrincipalComponents::GetClassName()
+      << ", components number=" << componentsNumber_
+      << ", eigen values=" << eigenValues_
+      << ", ee mean= " << elementaryEffectsMean_
+      << ", absolute ee mean= " << absoluteElementaryEffectsMean_
+      << ", ee std= " << elementaryEffectsStandardDeviation_;
+  return oss;
+}
+
+/* Method save() stores the object through the StorageManager */
+void MorrisPrincipalComponents::save(Advocate & adv) const
+{
+  Morris::save( adv );
+  adv.saveAttribute( "componentsNumber_", componentsNumber_ );
+  adv.saveAttribute( "eigenValues_", eigenValues_ );
+  adv.saveAttribute( "outputMean_", outputMean_ );
+  adv.saveAttribute( "basis_", basis_ );
+}
+
+/* Method load() reloads the object from the StorageManager */
+void MorrisPrincipalComponents::load(Advocate & adv)
+{
+  Morris::load( adv );
+  adv.loadAttribute( "componentsNumber_", componentsNumber_ );
+  adv.loadAttribute( "eigenValues_", eigenValues_ );
+  adv.loadAttribute( "outputMean_", outputMean_ );
+  adv.loadAttribute( "basis_", basis_ );
+}
+
+
+} /* namespace OTMORRIS */
@@ -0,0 +1,203 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief MorrisSurrogate
+ *
+ *  Copyright 2005-2024 Airbus-EDF-IMACS-Phimeca
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+ *
+ */
+#include "otmorris/MorrisSurrogate.hxx"
+
+#include <openturns/PersistentObjectFactory.hxx>
+#include <openturns/JointDistribution.hxx>
+#include <openturns/Uniform.hxx>
+#include <openturns/LHSExperiment.hxx>
+#include <openturns/FunctionalChaosAlgorithm.hxx>
+#include <openturns/SpecFunc.hxx>
+#include <openturns/Log.hxx>
+#include <algorithm>
+
+using namespace OT;
+
+namespace OTMORRIS
+{
+
+CLASSNAMEINIT(MorrisSurrogate)
+
+static const Factory<MorrisSurrogate> Factory_MorrisSurrogate;
+
+/** Default constructor */
+MorrisSurrogate::MorrisSurrogate()
+  : Morris()
+  , trainingInputSample_()
+  , trainingOutputSample_()
+  , metaModel_()
+  , predictivityFactor_()
+{}
+
+/** Standard constructor with experiment, model and number of model evaluations */
+MorrisSurrogate::MorrisSurrogate(const MorrisExperiment & experiment, const Function & model, const UnsignedInteger trainingSize)
+  : Morris()
+  , trainingInputSample_()
+  , trainingOutputSample_()
+  , metaModel_()
+  , predictivityFactor_()
+{
+  if (experiment.getSize() == 0)
+    throw InvalidArgumentException(HERE) << "In MorrisSurrogate::MorrisSurrogate, samples should not be empty";
+  interval_ = experiment.getBounds();
+  const UnsignedInteger inputDimension = interval_.getDimension();
+  if (model.getInputDimension() != inputDimension)
+    throw InvalidArgumentException(HERE) << "In MorrisSurrogate::MorrisSurrogate, model should have the same input dimension as the experiment. Here, experiment's dimension=" << inputDimension
+                                         << ", model's input dimension=" << model.getInputDimension();
+  if (trainingSize < 2)
+    throw InvalidArgumentException(HERE) << "In MorrisSurrogate::MorrisSurrogate, training size should be at least 2, here training size=" << trainingSize;
+
+  // Uniform distribution over the bounds
+  const Point lowerBound(interval_.getLowerBound());
+  const Point upperBound(interval_.getUpperBound());
+  Collection<Distribution> marginals(inputDimension);
+  for (UnsignedInteger i = 0; i < inputDimension; ++i)
+    marginals[i] = Uniform(lowerBound[i], upperBound[i]);
+  const JointDistribution distribution(marginals);
+
+  // The only evaluations of the model
+  trainingInputSample_ = LHSExperiment(distribution, trainingSize).generate();
+  trainingOutputSample_ = model(trainingInputSample_);
+  metaModel_ = BuildMetaModel(trainingInputSample_, trainingOutputSample_, distribution);
+
+  // K-fold cross-validation of the metamodel
+  const UnsignedInteger outputDimension = trainingOutputSample_.getDimension();
+  const UnsignedInteger foldsNumber = std::min(trainingSize, static_cast<UnsignedInteger>(5));
+  Point squaredErrors(outputDimension);
+  for (UnsignedInteger fold = 0; fold < foldsNumber; ++fold)
+  {
+    Indices learningIndices;
+    Indices testIndices;
+    for (UnsignedInteger k = 0; k < trainingSize; ++k)
+    {
+      if (k % foldsNumber == fold)
+        testIndices.add(k);
+      else
+        learningIndices.add(k);
+    }
+    const Function foldMetaModel(BuildMetaModel(trainingInputSample_.select(learningIndices), trainingOutputSample_.select(learningIndices), distribution));
+    const Sample predictions(foldMetaModel(trainingInputSample_.select(testIndices)));
+    for (UnsignedInteger k = 0; k < testIndices.getSize(); ++k)
+      for (UnsignedInteger j = 0; j < outputDimension; ++j)
+      {
+        const Scalar error = predictions(k, j) - trainingOutputSample_(testIndices[k], j);
+        squaredErrors[j] += error * error;
+      }
+  }
+  const Point mean(trainingOutputSample_.computeMean());
+  const Point variance(trainingOutputSample_.computeVariance());
+  predictivityFactor_ = Point(outputDimension);
+  for (UnsignedInteger j = 0; j < outputDimension; ++j)
+  {
+    const Scalar totalSquares = (trainingSize - 1.0) * variance[j];
+    // Round-off level of the sums of squares, with an absolute floor for outputs equal to zero
+    const Scalar tolerance = SpecFunc::ScalarEpsilon * trainingSize * (mean[j] * mean[j] + variance[j] + 1.0);
+    if (totalSquares > tolerance)
+      predictivityFactor_[j] = 1.0 - squaredErrors[j] / totalSquares;
+    else
+      // Constant output on the training design: the metamodel is either exact or useless
+      predictivityFactor_[j] = (squaredErrors[j] <= tolerance) ? 1.0 : 0.0;
+  }
+  Log::Info(OSS() << "In MorrisSurrogate::MorrisSurrogate, predictivity factor=" << predictivityFactor_);
+
+  // Evaluation of the full design on the metamodel, in a single batch
+  inputSample_ = experiment.generate();
+  inputSample_.setDescription(model.getInputDescription());
+  outputSample_ = metaModel_(inputSample_);
+  outputSample_.setDescription(trainingOutputSample_.getDescription());
+
+  // Perform evaluation of elementary effects
+  const UnsignedInteger N = inputSample_.getSize() / (inputDimension + 1);
+  computeEffects(N);
+}
+
+/* Virtual constructor method */
+MorrisSurrogate * MorrisSurrogate::clone() const
+{
+  return new MorrisSurrogate(*this);
+}
+
+/* Train a metamodel */
+Function MorrisSurrogate::BuildMetaModel(const Sample & inputSample, const Sample & outputSample, const Distribution & distribution)
+{
+  FunctionalChaosAlgorithm algorithm(inputSample, outputSample, distribution);
+  algorithm.run();
+  return algorithm.getResult().getMetaModel();
+}
+
+/* Metamodel accessor */
+Function MorrisSurrogate::getMetaModel() const
+{
+  return metaModel_;
+}
+
+Sample MorrisSurrogate::getTrainingInputSample() const
+{
+  return trainingInputSample_;
+}
+
+Sample MorrisSurrogate::getTrainingOutputSample() const
+{
+  return trainingOutputSample_;
+}
+
+/* Cross-validation predictivity factor of the metamodel */
+Point MorrisSurrogate::getPredictivityFactor() const
+{
+  return predictivityFactor_;
+}
+
+/* String converter */
+String MorrisSurrogate::__repr__() const
+{
+  OSS oss;
+  oss << "class=" << MorrisSurrogate::GetClassName()
+      << ", training size=" << trainingInputSample_.getSize()
+      << ", predictivity factor=" << predictivityFactor_
+      << ", ee mean= " << elementaryEffectsMean_
+      << ", absolute ee mean= " << absoluteElementaryEffectsMean_
+      << ", ee std= " << elementaryEffectsStandardDeviation_;
+  return oss;
+}
+
+/* Method save() stores the object through the StorageManager */
+void MorrisSurrogate::save(Advocate & adv) const
+{
+  Morris::save( adv );
+  adv.saveAttribute( "predictivityFactor_", predictivityFactor_ );
+  adv.saveAttribute( "metaModel_", metaModel_ );
+  adv.saveAttribute( "trainingInputSample_", trainingInputSample_ );
+  adv.saveAttribute( "trainingOutputSample_", trainingOutputSample_ );
+}
+
+/* Method load() reloads the object from the StorageManager */
+void MorrisSurrogate::load(Advocate & adv)
+{
+  Morris::load( adv );
+  adv.loadAttribute( "predictivityFactor_", predictivityFactor_ );
+  adv.loadAttribute( "metaModel_", metaModel_ );
+  adv.loadAttribute( "trainingInputSample_", trainingInputSample_ );
+  adv.loadAttribute( "trainingOutputSample_", trainingOutputSample_ );
+}
+
+
+} /* namespace OTMORRIS */
@@ -25,6 +25,8 @@
 #include <openturns/TypedInterfaceObject.hxx>
 #include <openturns/StorageManager.hxx>
 #include <openturns/Function.hxx>
+#include <openturns/GridLayout.hxx>
+#include <openturns/SpecFunc.hxx>
 #include "otmorris/OTMORRISprivate.hxx"
 #include "otmorris/MorrisExperiment.hxx"
 
@@ -55,12 +57,34 @@ public:
   OT::Point getStandardDeviationElementaryEffects(const OT::UnsignedInteger outputMarginal = 0) const;
 
   // Draw result
-  OT::Graph drawElementaryEffects(OT::UnsignedInteger outputMarginal = 0, OT::Bool absoluteMean = true) const;
+  OT::Graph drawElementaryEffects(const OT::UnsignedInteger outputMarginal = 0,
+                                  const OT::Bool absoluteMean = true,
+                                  const OT::UnsignedInteger labelsNumber = OT::SpecFunc::MaxUnsignedInteger,
+                                  const OT::Bool rankBySigma = false,
+                                  const OT::UnsignedInteger binNumber = 0) const;
+
+  // Draw results of several outputs
+  OT::GridLayout drawElementaryEffects(const OT::Indices & outputMarginals,
+                                       const OT::Bool absoluteMean = true,
+                                       const OT::UnsignedInteger labelsNumber = OT::SpecFunc::MaxUnsignedInteger,
+                                       const OT::Bool rankBySigma = false,
+                                       const OT::UnsignedInteger binNumber = 0) const;
 
   // Sample accessors
   OT::Sample getInputSample() const;
   OT::Sample getOutputSample() const;
 
+  // Number of model evaluations saved by removing duplicated design points
+  OT::UnsignedInteger getSavedCallsNumber() const;
+
+#ifndef SWIG
+  // Evaluate the model once per distinct point of the design
+  static OT::Sample EvaluateDistinctPoints(const OT::Function & model,
+                                           const OT::Sample & inputSample,
+                                           const OT::Interval & interval,
+                                           OT::UnsignedInteger & savedCallsNumber);
+#endif
+
   /** String converter */
   OT::String __repr__() const override;
 
@@ -74,14 +98,21 @@ protected:
   // Method that allocate and compute effects
   void computeEffects(const OT::UnsignedInteger N);
 
-private:
+  // Welford update of the running statistics with a new elementary effect
+  static void UpdateStatistics(const OT::Scalar effect, const OT::Scalar weight, OT::Scalar & mean, OT::Scalar & absoluteMean, OT::Scalar & squaredDeviations);
+
+  // Store the statistics from the running sums and the number of effects of each input
+  void setStatistics(const OT::Point & mean, const OT::Point & absoluteMean, const OT::Point & squaredDeviations, const OT::Indices & effectsNumber);
+
   OT::Sample inputSample_;
   OT::Sample outputSample_;
   OT::Interval interval_; // Bounds
-  // Elementary effects ==> N x (p*q) sample
+  // Statistics of elementary effects ==> q x p samples
   OT::Sample elementaryEffectsMean_;
   OT::Sample elementaryEffectsStandardDeviation_;
   OT::Sample absoluteElementaryEffectsMean_;
+  // Number of duplicated design points not evaluated
+  OT::UnsignedInteger savedCallsNumber_;
 
 }; /* class Morris */
 
@@ -0,0 +1,81 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief MorrisDatabase estimates elementary effects from an existing
+ *  evaluation database
+ *
+ *  Copyright 2005-2024 Airbus-EDF-IMACS-Phimeca
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+ *
+ */
+#ifndef OTMORRIS_MORRISDATABASE_HXX
+#define OTMORRIS_MORRISDATABASE_HXX
+
+#include "otmorris/Morris.hxx"
+
+namespace OTMORRIS
+{
+/**
+ * @class MorrisDatabase
+ *
+ * MorrisDatabase computes the Morris statistics from the one-at-a-time
+ * pairs found in an arbitrary input/output sample
+ */
+class OTMORRIS_API MorrisDatabase
+  : public Morris
+{
+  CLASSNAME
+
+public:
+  /** Default constructor for save/load mechanism */
+  MorrisDatabase();
+
+  /** Standard constructor with in/out samples and tolerance */
+  MorrisDatabase(const OT::Sample & inputSample, const OT::Sample & outputSample, const OT::Interval & interval, const OT::Scalar tolerance);
+
+  /** Virtual constructor method */
+  MorrisDatabase * clone() const override;
+
+  /** Number of pairs used for each input */
+  OT::Indices getPairsNumber() const;
+
+  /** Tolerance accessor */
+  OT::Scalar getTolerance() const;
+
+  /** String converter */
+  OT::String __repr__() const override;
+
+  /** Method save() stores the object through the StorageManager */
+  void save(OT::Advocate & adv) const override;
+
+  /** Method load() reloads the object from the StorageManager */
+  void load(OT::Advocate & adv) override;
+
+protected:
+  // Method that finds the pairs and computes the statistics
+  void computePairEffects();
+
+private:
+  // Tolerance on the normalized coordinates
+  OT::Scalar tolerance_;
+
+  // Number of pairs for each input
+  OT::Indices pairsNumber_;
+
+}; /* class MorrisDatabase */
+
+} /* namespace OTMORRIS */
+
+#endif /* OTMORRIS_MORRISDATABASE_HXX */
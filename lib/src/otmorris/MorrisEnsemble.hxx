@@ -0,0 +1,105 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief MorrisEnsemble runs replicated Morris screenings with a single
+ *  evaluation of the model
+ *
+ *  Copyright 2005-2024 Airbus-EDF-IMACS-Phimeca
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+ *
+ */
+#ifndef OTMORRIS_MORRISENSEMBLE_HXX
+#define OTMORRIS_MORRISENSEMBLE_HXX
+
+#include "otmorris/Morris.hxx"
+
+namespace OTMORRIS
+{
+/**
+ * @class MorrisEnsemble
+ *
+ * MorrisEnsemble generates several independent Morris designs, evaluates
+ * them in a single call to the model and gathers the replicated statistics
+ */
+class OTMORRIS_API MorrisEnsemble
+  : public OT::PersistentObject
+{
+  CLASSNAME
+
+public:
+  /** Default constructor for save/load mechanism */
+  MorrisEnsemble();
+
+  /** Standard constructor with experiment, model and number of replicates */
+  MorrisEnsemble(const MorrisExperiment & experiment, const OT::Function & model, const OT::UnsignedInteger replicatesNumber);
+
+  /** Virtual constructor method */
+  MorrisEnsemble * clone() const override;
+
+  // Replicates accessors
+  OT::UnsignedInteger getReplicatesNumber() const;
+  OT::Indices getSeeds() const;
+  Morris getReplicate(const OT::UnsignedInteger index) const;
+
+  // Statistics of each replicate ==> R x p samples
+  OT::Sample getMeanAbsoluteElementaryEffectsSample(const OT::UnsignedInteger outputMarginal = 0) const;
+  OT::Sample getMeanElementaryEffectsSample(const OT::UnsignedInteger outputMarginal = 0) const;
+  OT::Sample getStandardDeviationElementaryEffectsSample(const OT::UnsignedInteger outputMarginal = 0) const;
+
+  // Spread of the statistics: standard deviation across the replicates
+  OT::Point getMeanAbsoluteElementaryEffectsSpread(const OT::UnsignedInteger outputMarginal = 0) const;
+  OT::Point getMeanElementaryEffectsSpread(const OT::UnsignedInteger outputMarginal = 0) const;
+  OT::Point getStandardDeviationElementaryEffectsSpread(const OT::UnsignedInteger outputMarginal = 0) const;
+
+  // Sample accessors, the designs of the replicates one after the other
+  OT::Sample getInputSample() const;
+  OT::Sample getOutputSample() const;
+
+  // Number of model evaluations saved by removing duplicated design points
+  OT::UnsignedInteger getSavedCallsNumber() const;
+
+  /** String converter */
+  OT::String __repr__() const override;
+
+  /** Method save() stores the object through the StorageManager */
+  void save(OT::Advocate & adv) const override;
+
+  /** Method load() reloads the object from the StorageManager */
+  void load(OT::Advocate & adv) override;
+
+protected:
+  // Method that computes the statistics of all the replicates
+  void computeReplicates();
+
+  // Columns of an output marginal in a statistics sample
+  OT::Sample getMarginalStatistics(const OT::Sample & statistics, const OT::UnsignedInteger outputMarginal) const;
+
+private:
+  OT::Sample inputSample_;
+  OT::Sample outputSample_;
+  OT::Interval interval_; // Bounds
+  OT::Indices seeds_;
+  // Statistics of the replicates ==> R x (p q) samples, index = input + output * p
+  OT::Sample elementaryEffectsMeanSample_;
+  OT::Sample elementaryEffectsStandardDeviationSample_;
+  OT::Sample absoluteElementaryEffectsMeanSample_;
+  // Number of duplicated design points not evaluated
+  OT::UnsignedInteger savedCallsNumber_;
+
+}; /* class MorrisEnsemble */
+
+} /* namespace OTMORRIS */
+
+#endif /* OTMORRIS_MORRISENSEMBLE_HXX */
@@ -62,6 +62,12 @@ public:
   /** Generate method */
   OT::Sample generate() const override;
 
+  /** Whether the design has enough starting points for sharded generation */
+  OT::Bool isShardable() const;
+
+  /** Generate the trajectories of one shard of the design */
+  OT::Sample generateShard(const OT::UnsignedInteger shardIndex, const OT::UnsignedInteger shardNumber, const OT::UnsignedInteger seed) const;
+
   /** String converter */
   OT::String __repr__() const override;
 
@@ -73,6 +79,18 @@ public:
 
 protected:
 
+  /** Number of distinct starting points available for sharded generation */
+  virtual OT::UnsignedInteger getStartingPointsNumber() const;
+
+  /** Generate the trajectory of a shard given its starting point and first axis */
+  virtual OT::Sample generateShardTrajectory(const OT::UnsignedInteger startingPoint, const OT::UnsignedInteger firstAxis) const;
+
+  /** Hash of an index, keyed by a seed */
+  static OT::UnsignedInteger HashIndex(const OT::UnsignedInteger index, const OT::UnsignedInteger seed);
+
+  /** Pseudo-random permutation of {0,...,size-1}, keyed by a seed */
+  static OT::UnsignedInteger PermuteIndex(const OT::UnsignedInteger index, const OT::UnsignedInteger size, const OT::UnsignedInteger seed);
+
   // Bounds
   OT::Interval interval_;
 
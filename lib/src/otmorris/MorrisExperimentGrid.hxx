@@ -75,6 +75,15 @@ protected:
   /** Generate a trajectory */
   OT::Sample generateTrajectory() const;
 
+  /** Generate a trajectory from a grid node and a permutation of the axes */
+  OT::Sample generateTrajectory(const OT::Indices & start, const OT::Point & permutations) const;
+
+  /** Number of distinct starting points available for sharded generation */
+  OT::UnsignedInteger getStartingPointsNumber() const override;
+
+  /** Generate the trajectory of a shard given its starting point and first axis */
+  OT::Sample generateShardTrajectory(const OT::UnsignedInteger startingPoint, const OT::UnsignedInteger firstAxis) const override;
+
 private:
 
   // jumpStep: integers!
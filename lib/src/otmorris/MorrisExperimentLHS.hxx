@@ -69,6 +69,11 @@ protected:
   // generate method with lhs design
   OT::Point generateXBaseFromLHS() const;
 
+  /** Number of distinct starting points available for sharded generation */
+  OT::UnsignedInteger getStartingPointsNumber() const override;
+
+  /** Generate the trajectory of a shard given its starting point and first axis */
+  OT::Sample generateShardTrajectory(const OT::UnsignedInteger startingPoint, const OT::UnsignedInteger firstAxis) const override;
 
 private:
 
@@ -78,6 +83,9 @@ private:
   /** Generate 1 trajectory */
   OT::Sample generateTrajectory(const OT::UnsignedInteger index) const;
 
+  /** Generate 1 trajectory given the permutation of the axes */
+  OT::Sample generateTrajectory(const OT::UnsignedInteger index, const OT::Point & permutations) const;
+
 }; /* class MorrisExperimentLHS */
 
 } /* namespace OTMORRIS */
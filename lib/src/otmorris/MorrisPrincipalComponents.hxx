@@ -0,0 +1,96 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief MorrisPrincipalComponents computes the Morris statistics of
+ *  field outputs in the space of their principal components
+ *
+ *  Copyright 2005-2024 Airbus-EDF-IMACS-Phimeca
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+ *
+ */
+#ifndef OTMORRIS_MORRISPRINCIPALCOMPONENTS_HXX
+#define OTMORRIS_MORRISPRINCIPALCOMPONENTS_HXX
+
+#include <openturns/Matrix.hxx>
+#include "otmorris/Morris.hxx"
+
+namespace OTMORRIS
+{
+/**
+ * @class MorrisPrincipalComponents
+ *
+ * MorrisPrincipalComponents projects the output sample onto its leading
+ * principal components before computing the elementary effects
+ */
+class OTMORRIS_API MorrisPrincipalComponents
+  : public Morris
+{
+  CLASSNAME
+
+public:
+  /** Default constructor for save/load mechanism */
+  MorrisPrincipalComponents();
+
+  /** Standard constructor with in/out designs and number of components */
+  MorrisPrincipalComponents(const OT::Sample & inputSample, const OT::Sample & outputSample, const OT::Interval & interval, const OT::UnsignedInteger componentsNumber);
+
+  /** Virtual constructor method */
+  MorrisPrincipalComponents * clone() const override;
+
+  // Generalized Mean/Standard deviation, aggregated over the components
+  OT::Point getGeneralizedMeanAbsoluteElementaryEffects() const;
+  OT::Point getGeneralizedMeanElementaryEffects() const;
+  OT::Point getGeneralizedStandardDeviationElementaryEffects() const;
+
+  // Principal components accessors
+  OT::UnsignedInteger getComponentsNumber() const;
+  OT::Matrix getBasis() const;
+  OT::Point getOutputMean() const;
+  OT::Point getEigenValues() const;
+
+  /** String converter */
+  OT::String __repr__() const override;
+
+  /** Method save() stores the object through the StorageManager */
+  void save(OT::Advocate & adv) const override;
+
+  /** Method load() reloads the object from the StorageManager */
+  void load(OT::Advocate & adv) override;
+
+protected:
+  // Randomized SVD of the centered output sample, returns the scores
+  OT::Sample computePrincipalComponents(const OT::Sample & outputSample);
+
+  // Product of the centered sample by a matrix, one row at a time
+  static OT::Matrix MultiplyCentered(const OT::Sample & sample, const OT::Point & mean, const OT::Matrix & matrix);
+
+  // Product of the transposed centered sample by a matrix, one row at a time
+  static OT::Matrix MultiplyCenteredTransposed(const OT::Sample & sample, const OT::Point & mean, const OT::Matrix & matrix);
+
+  // Euclidean norm over the components of each input
+  static OT::Point ComputeColumnNorms(const OT::Sample & statistics);
+
+private:
+  OT::UnsignedInteger componentsNumber_;
+  // Orthonormal basis of the components ==> q x k matrix
+  OT::Matrix basis_;
+  OT::Point outputMean_;
+  OT::Point eigenValues_;
+
+}; /* class MorrisPrincipalComponents */
+
+} /* namespace OTMORRIS */
+
+#endif /* OTMORRIS_MORRISPRINCIPALCOMPONENTS_HXX */
@@ -0,0 +1,89 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief MorrisSurrogate performs the Morris method on a metamodel
+ *
+ *  Copyright 2005-2024 Airbus-EDF-IMACS-Phimeca
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+ *
+ */
+#ifndef OTMORRIS_MORRISSURROGATE_HXX
+#define OTMORRIS_MORRISSURROGATE_HXX
+
+#include <openturns/Distribution.hxx>
+#include "otmorris/Morris.hxx"
+
+namespace OTMORRIS
+{
+/**
+ * @class MorrisSurrogate
+ *
+ * MorrisSurrogate trains a polynomial chaos metamodel on a small number of
+ * model evaluations and computes the elementary effects on the metamodel
+ */
+class OTMORRIS_API MorrisSurrogate
+  : public Morris
+{
+  CLASSNAME
+
+public:
+  /** Default constructor for save/load mechanism */
+  MorrisSurrogate();
+
+  /** Standard constructor with experiment, model and number of model evaluations */
+  MorrisSurrogate(const MorrisExperiment & experiment, const OT::Function & model, const OT::UnsignedInteger trainingSize);
+
+  /** Virtual constructor method */
+  MorrisSurrogate * clone() const override;
+
+  /** Metamodel accessor */
+  OT::Function getMetaModel() const;
+
+  // Training sample accessors
+  OT::Sample getTrainingInputSample() const;
+  OT::Sample getTrainingOutputSample() const;
+
+  /** Cross-validation predictivity factor of the metamodel */
+  OT::Point getPredictivityFactor() const;
+
+  /** String converter */
+  OT::String __repr__() const override;
+
+  /** Method save() stores the object through the StorageManager */
+  void save(OT::Advocate & adv) const override;
+
+  /** Method load() reloads the object from the StorageManager */
+  void load(OT::Advocate & adv) override;
+
+protected:
+  /** Train a metamodel */
+  static OT::Function BuildMetaModel(const OT::Sample & inputSample, const OT::Sample & outputSample, const OT::Distribution & distribution);
+
+private:
+  // Model evaluations used to train the metamodel
+  OT::Sample trainingInputSample_;
+  OT::Sample trainingOutputSample_;
+
+  // Metamodel
+  OT::Function metaModel_;
+
+  // K-fold predictivity factor Q2 of each output
+  OT::Point predictivityFactor_;
+
+}; /* class MorrisSurrogate */
+
+} /* namespace OTMORRIS */
+
+#endif /* OTMORRIS_MORRISSURROGATE_HXX */
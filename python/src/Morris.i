@@ -13,6 +13,8 @@
 %pythoncode %{
 
 import openturns as ot
+import multiprocessing as _multiprocessing
+from multiprocessing import shared_memory as _shared_memory
 
 class MorrisFunction(ot.OpenTURNSPythonFunction):
     """
@@ -103,4 +105,137 @@ class MorrisFunction(ot.OpenTURNSPythonFunction):
                         y += b4[i][j][k][l] * w[i] * w[j] * w[k] * w[l]
 
         return [y + self.b0]
+
+
+# Function evaluated by the current worker process of a MorrisPoolFunction
+_morris_pool_function = None
+
+def _morris_pool_initializer(function):
+    global _morris_pool_function
+    _morris_pool_function = ot.Function(function)
+
+def _morris_pool_evaluate(task):
+    """Evaluate the rows [start, stop) of the shared input buffer."""
+    import numpy as np
+    inputName, outputName, size, start, stop, inputDimension, outputDimension = task
+    inputMemory = _shared_memory.SharedMemory(name=inputName)
+    try:
+        outputMemory = _shared_memory.SharedMemory(name=outputName)
+        try:
+            # the views must be released before the memory is closed
+            inputArray = np.ndarray((size, inputDimension), dtype=np.float64, buffer=inputMemory.buf)
+            try:
+                X = ot.Sample(inputArray[start:stop])
+            finally:
+                del inputArray
+            Y = _morris_pool_function(X)
+            outputArray = np.ndarray((size, outputDimension), dtype=np.float64, buffer=outputMemory.buf)
+            try:
+                outputArray[start:stop] = np.asarray(Y)
+            finally:
+                del outputArray
+        finally:
+            outputMemory.close()
+    finally:
+        inputMemory.close()
+
+class MorrisPoolFunction(ot.OpenTURNSPythonFunction):
+    """
+    Evaluation of a Python model in a pool of local processes.
+
+    Python models are evaluated on a single core because of the GIL.
+    This wrapper splits the input sample into contiguous blocks made
+    of whole trajectories and evaluates them in a pool of worker processes.
+    Inputs and outputs are exchanged through shared memory, viewed as numpy
+    arrays on both sides, only the block bounds are sent to the workers.
+    The wrapper requires numpy.
+
+    Parameters
+    ----------
+    function : :py:class:`openturns.OpenTURNSPythonFunction` or :py:class:`openturns.Function`
+        Model to evaluate, it must be picklable to be sent to the workers
+    processesNumber : int, optional
+        Number of worker processes, default is the number of cores
+    blockSize : int, optional
+        Number of trajectories per block, the blocks contain
+        `blockSize * (inputDimension + 1)` points.
+        Default gives four blocks per process.
+
+    Notes
+    -----
+    The pool is created for each call on a sample and closed afterwards, so
+    the wrapper is intended for models whose evaluation is much more expensive
+    than the start of a process.
+    With the *spawn* start method (Windows, macOS), the calling script
+    must be protected by `if __name__ == "__main__":`.
+
+    Examples
+    --------
+    >>> import openturns as ot
+    >>> import otmorris
+    >>> model = ot.Function(otmorris.MorrisPoolFunction(otmorris.MorrisFunction(), 4))
+    >>> experiment = otmorris.MorrisExperimentGrid([5] * 20, 10)
+    >>> morris = otmorris.Morris(experiment, model)  # doctest: +SKIP
+    """
+    def __init__(self, function, processesNumber=None, blockSize=None):
+        ot.OpenTURNSPythonFunction.__init__(self, function.getInputDimension(), function.getOutputDimension())
+        self.setInputDescription(function.getInputDescription())
+        self.setOutputDescription(function.getOutputDescription())
+        if processesNumber is None:
+            processesNumber = _multiprocessing.cpu_count()
+        if processesNumber < 1:
+            raise ValueError("processesNumber should be positive, here processesNumber=%d" % processesNumber)
+        if blockSize is not None and blockSize < 1:
+            raise ValueError("blockSize should be positive, here blockSize=%d" % blockSize)
+        self._function = function
+        self._localFunction = ot.Function(function)
+        self._processesNumber = processesNumber
+        self._blockSize = blockSize
+
+    def _exec(self, x):
+        return self._localFunction(x)
+
+    def _exec_sample(self, X):
+        import numpy as np
+        X = np.asarray(X, dtype=np.float64)
+        size = X.shape[0]
+        inputDimension = self.getInputDimension()
+        outputDimension = self.getOutputDimension()
+        if size == 0:
+            return ot.Sample(0, outputDimension)
+        # Blocks made of whole trajectories of inputDimension + 1 points
+        trajectoryLength = inputDimension + 1
+        trajectoriesNumber = (size + trajectoryLength - 1) // trajectoryLength
+        blockSize = self._blockSize
+        if blockSize is None:
+            blocksNumber = 4 * self._processesNumber
+            blockSize = max(1, (trajectoriesNumber + blocksNumber - 1) // blocksNumber)
+        blockLength = blockSize * trajectoryLength
+        inputMemory = _shared_memory.SharedMemory(create=True, size=X.nbytes)
+        try:
+            outputMemory = _shared_memory.SharedMemory(create=True, size=8 * size * outputDimension)
+            try:
+                inputArray = np.ndarray(X.shape, dtype=np.float64, buffer=inputMemory.buf)
+                try:
+                    inputArray[:] = X
+                finally:
+                    del inputArray
+                tasks = [(inputMemory.name, outputMemory.name, size, start, min(start + blockLength, size), inputDimension, outputDimension)
+                         for start in range(0, size, blockLength)]
+                processesNumber = min(self._processesNumber, len(tasks))
+                with _multiprocessing.Pool(processesNumber, _morris_pool_initializer, (self._function,)) as pool:
+                    pool.map(_morris_pool_evaluate, tasks, chunksize=1)
+                outputArray = np.ndarray((size, outputDimension), dtype=np.float64, buffer=outputMemory.buf)
+                try:
+                    Y = ot.Sample(outputArray)
+                finally:
+                    del outputArray
+            finally:
+                outputMemory.unlink()
+                outputMemory.close()
+        finally:
+            inputMemory.unlink()
+            inputMemory.close()
+        Y.setDescription(self.getOutputDescription())
+        return Y
 %}
@@ -0,0 +1,11 @@
+// SWIG file
+
+%{
+#include "otmorris/MorrisDatabase.hxx"
+%}
+
+%include MorrisDatabase_doc.i
+
+%copyctor OTMORRIS::MorrisDatabase;
+
+%include otmorris/MorrisDatabase.hxx
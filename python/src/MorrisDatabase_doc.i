@@ -0,0 +1,74 @@
+%feature("docstring") OTMORRIS::MorrisDatabase
+R"RAW(Morris statistics from an existing evaluation database.
+
+Parameters
+----------
+inputSample : :py:class:`openturns.Sample`
+    Input points, not necessarily organized as Morris trajectories
+outputSample : :py:class:`openturns.Sample`
+    Response model applied on `inputSample`
+interval : :py:class:`openturns.Interval`
+    Bounds of the inputs, used to normalize the coordinates
+tolerance : float
+    Tolerance on the normalized coordinates
+
+Notes
+-----
+The elementary effects are computed from one-at-a-time pairs found in the
+sample, so that no new evaluation of the model is needed.
+The coordinates are first normalized to :math:`[0,1]^p` thanks to the bounds.
+For each input :math:`i`, a k-d tree is built over the :math:`p-1` other coordinates.
+Each point :math:`\vect{x}^a` is paired with the point :math:`\vect{x}^b` such that:
+
+- :math:`|x^b_j - x^a_j| \leq \epsilon` for all :math:`j \neq i`,
+- :math:`x^b_i - x^a_i > 10 \epsilon`, the smallest one among the candidates,
+
+where :math:`\epsilon` is the tolerance. The other coordinates may differ by up to :math:`\epsilon`,
+which adds to the effect about :math:`\epsilon / (x^b_i - x^a_i)` times the derivatives with
+respect to the other inputs: requiring a step larger than :math:`10 \epsilon` keeps this bias small.
+The elementary effect of the pair is:
+
+.. math::
+
+    d_i = \frac{\cM(\vect{x}^b) - \cM(\vect{x}^a)}{x^b_i - x^a_i}
+
+The mean, mean of absolute values and standard deviation of these effects are
+available through the accessors of :class:`~otmorris.Morris`, and the number of
+pairs found for each input through :meth:`getPairsNumber`.
+A large tolerance finds more pairs but biases the effects with the variations of the other inputs.
+
+Examples
+--------
+>>> import openturns as ot
+>>> import otmorris
+>>> model = ot.SymbolicFunction(['x', 'y'], ['2 * x + 3 * y'])
+>>> X = ot.Box([4, 4]).generate()
+>>> Y = model(X)
+>>> morris = otmorris.MorrisDatabase(X, Y, ot.Interval(2), 1e-8)
+>>> print(morris.getMeanElementaryEffects())
+[2,3]
+>>> print(morris.getPairsNumber())
+[30,30]
+)RAW"
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMORRIS::MorrisDatabase::getPairsNumber
+"Accessor to the number of pairs found for each input.
+
+Returns
+-------
+pairsNumber : :py:class:`openturns.Indices`
+    Number of elementary effects computed for each input
+"
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMORRIS::MorrisDatabase::getTolerance
+"Accessor to the tolerance.
+
+Returns
+-------
+tolerance : float
+    Tolerance on the normalized coordinates
+"
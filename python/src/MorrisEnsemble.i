@@ -0,0 +1,11 @@
+// SWIG file
+
+%{
+#include "otmorris/MorrisEnsemble.hxx"
+%}
+
+%include MorrisEnsemble_doc.i
+
+%copyctor OTMORRIS::MorrisEnsemble;
+
+%include otmorris/MorrisEnsemble.hxx
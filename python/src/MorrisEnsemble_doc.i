@@ -0,0 +1,215 @@
+%feature("docstring") OTMORRIS::MorrisEnsemble
+R"RAW(Replicated Morris screenings.
+
+Parameters
+----------
+experiment : :py:class:`otmorris.MorrisExperiment`
+    Morris experiment, :class:`~otmorris.MorrisExperimentGrid` or :class:`~otmorris.MorrisExperimentLHS`
+model : :py:class:`openturns.Function`
+    Response model to be applied on input data
+replicatesNumber : int
+    Number :math:`R` of independent replicates
+
+Notes
+-----
+The conclusions of a screening depend on the random trajectories of the design.
+To assess their robustness, :math:`R` independent designs are generated thanks to
+:meth:`~otmorris.MorrisExperiment.generateShard` with distinct seeds, drawn from
+:py:class:`openturns.RandomGenerator`. The designs are concatenated and the model
+is evaluated in a single call, so that vectorized or parallel models get the full batch.
+The points shared by several trajectories or replicates are evaluated only once,
+see :meth:`getSavedCallsNumber`. The statistics of the replicates are then computed in parallel.
+
+The sharded designs never repeat a starting point and move first along different axes,
+which requires :math:`N \leq P p` where :math:`P` is the number of available starting
+points (the LHS size for :class:`~otmorris.MorrisExperimentLHS`), see
+:meth:`~otmorris.MorrisExperiment.isShardable`. Otherwise, each design is
+generated by :meth:`~otmorris.MorrisExperiment.generate` after :py:meth:`openturns.RandomGenerator.SetSeed`
+with its seed, and the state of the generator is restored afterwards.
+
+The statistics of each replicate are given as samples of size :math:`R`, and their
+spread by the standard deviation across the replicates.
+A replicate can also be retrieved as a :class:`~otmorris.Morris` object with :meth:`getReplicate`.
+
+Examples
+--------
+>>> import openturns as ot
+>>> import otmorris
+>>> ot.RandomGenerator.SetSeed(0)
+>>> model = ot.SymbolicFunction(['x', 'y', 'z'], ['x + 2 * y^2 + x * z'])
+>>> experiment = otmorris.MorrisExperimentGrid([5] * 3, 10)
+>>> ensemble = otmorris.MorrisEnsemble(experiment, model, 20)
+>>> mu_star = ensemble.getMeanAbsoluteElementaryEffectsSample()
+>>> spread = ensemble.getMeanAbsoluteElementaryEffectsSpread()
+)RAW"
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMORRIS::MorrisEnsemble::getReplicatesNumber
+"Accessor to the number of replicates.
+
+Returns
+-------
+replicatesNumber : int
+    Number of replicates
+"
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMORRIS::MorrisEnsemble::getSeeds
+"Accessor to the seeds of the designs.
+
+Returns
+-------
+seeds : :py:class:`openturns.Indices`
+    Seed given to :meth:`~otmorris.MorrisExperiment.generateShard` for each replicate
+"
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMORRIS::MorrisEnsemble::getReplicate
+"Accessor to a replicate.
+
+Parameters
+----------
+index : int
+    Index of the replicate
+
+Returns
+-------
+morris : :class:`~otmorris.Morris`
+    Morris screening of the replicate
+"
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMORRIS::MorrisEnsemble::getMeanAbsoluteElementaryEffectsSample
+"Get the mean of absolute elementary effects of each replicate.
+
+Parameters
+----------
+marginal : int
+    Output marginal of interest
+
+Returns
+-------
+mean : :py:class:`openturns.Sample`
+    The effects of each replicate, one row per replicate.
+"
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMORRIS::MorrisEnsemble::getMeanAbsoluteElementaryEffectsSpread
+"Get the spread of the mean of absolute elementary effects.
+
+Parameters
+----------
+marginal : int
+    Output marginal of interest
+
+Returns
+-------
+spread : :py:class:`openturns.Point`
+    Standard deviation across the replicates.
+"
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMORRIS::MorrisEnsemble::getMeanElementaryEffectsSample
+"Get the mean of elementary effects of each replicate.
+
+Parameters
+----------
+marginal : int
+    Output marginal of interest
+
+Returns
+-------
+mean : :py:class:`openturns.Sample`
+    The effects of each replicate, one row per replicate.
+"
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMORRIS::MorrisEnsemble::getMeanElementaryEffectsSpread
+"Get the spread of the mean of elementary effects.
+
+Parameters
+----------
+marginal : int
+    Output marginal of interest
+
+Returns
+-------
+spread : :py:class:`openturns.Point`
+    Standard deviation across the replicates.
+"
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMORRIS::MorrisEnsemble::getStandardDeviationElementaryEffectsSample
+"Get the standard deviation of elementary effects of each replicate.
+
+Parameters
+----------
+marginal : int
+    Output marginal of interest
+
+Returns
+-------
+sigma : :py:class:`openturns.Sample`
+    The effects of each replicate, one row per replicate.
+"
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMORRIS::MorrisEnsemble::getStandardDeviationElementaryEffectsSpread
+"Get the spread of the standard deviation of elementary effects.
+
+Parameters
+----------
+marginal : int
+    Output marginal of interest
+
+Returns
+-------
+spread : :py:class:`openturns.Point`
+    Standard deviation across the replicates.
+"
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMORRIS::MorrisEnsemble::getInputSample
+"Accessor to the input sample.
+
+Returns
+-------
+inputSample : :py:class:`openturns.Sample`
+    Designs of the replicates, one after the other
+"
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMORRIS::MorrisEnsemble::getOutputSample
+"Accessor to the output sample.
+
+Returns
+-------
+outputSample : :py:class:`openturns.Sample`
+    Evaluations of the model on the input sample
+"
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMORRIS::MorrisEnsemble::getSavedCallsNumber
+"Accessor to the number of saved model evaluations.
+
+The duplicated points of the concatenated designs are evaluated only once,
+as in :class:`~otmorris.Morris`.
+
+Returns
+-------
+savedCallsNumber : int
+    Number of points of the input sample that were not evaluated by the model
+    because they duplicate another point of the designs
+"
@@ -26,3 +26,69 @@ Returns
 sample : :py:class:`openturns.Sample`
     Points that constitute the design of experiment, of size :math:`N \times (p+1)`
 )RAW"
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMORRIS::MorrisExperiment::isShardable
+R"RAW(Whether the design can be generated by shards.
+
+Sharded generation needs distinct trajectories: each of the :math:`P`
+available starting points (grid nodes or points of the LHS design) is shared
+by at most :math:`p` trajectories, one per first axis.
+
+Returns
+-------
+shardable : bool
+    Whether :math:`N \leq P p`, in which case :meth:`generateShard` can be used
+
+Examples
+--------
+>>> import otmorris
+>>> otmorris.MorrisExperimentGrid([5] * 3, 10).isShardable()
+True
+)RAW"
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMORRIS::MorrisExperiment::generateShard
+R"RAW(Generate the trajectories of one shard of the design.
+
+The :math:`N` trajectories of the design are split into `shardNumber`
+consecutive ranges; shard :math:`k` contains the trajectories of indices
+:math:`\lfloor kN/K \rfloor` to :math:`\lfloor (k+1)N/K \rfloor - 1`.
+Each trajectory only depends on its index and on the seed, so that shards
+can be generated independently, e.g. on different nodes, and their
+concatenation does not depend on the number of shards.
+
+The trajectory of index :math:`k` starts from the point
+:math:`\pi(k \bmod P)` where :math:`\pi` is a permutation keyed by the seed
+and :math:`P` is the number of available starting points (grid nodes or
+points of the LHS design). Trajectories sharing the same starting point move
+first along different axes, so that all the trajectories are distinct.
+This requires :math:`N \leq P p`, see :meth:`isShardable`.
+
+The state of the :py:class:`openturns.RandomGenerator` is left unchanged.
+
+Parameters
+----------
+shardIndex : int
+    Index of the shard, lesser than `shardNumber`
+shardNumber : int
+    Number of shards
+seed : int
+    Seed shared by all the shards
+
+Returns
+-------
+sample : :py:class:`openturns.Sample`
+    Points of the trajectories of the shard
+
+Examples
+--------
+>>> import otmorris
+>>> experiment = otmorris.MorrisExperimentGrid([5] * 3, 10)
+>>> X0 = experiment.generateShard(0, 2, 42)
+>>> X1 = experiment.generateShard(1, 2, 42)
+>>> X0.getSize() + X1.getSize()
+40
+)RAW"
@@ -0,0 +1,11 @@
+// SWIG file
+
+%{
+#include "otmorris/MorrisPrincipalComponents.hxx"
+%}
+
+%include MorrisPrincipalComponents_doc.i
+
+%copyctor OTMORRIS::MorrisPrincipalComponents;
+
+%include otmorris/MorrisPrincipalComponents.hxx
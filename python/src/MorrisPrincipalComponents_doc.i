@@ -0,0 +1,133 @@
+%feature("docstring") OTMORRIS::MorrisPrincipalComponents
+R"RAW(Morris method on the principal components of the outputs.
+
+Parameters
+----------
+inputSample : :py:class:`openturns.Sample`
+    Experiment generated thanks to the `generate` method of the :class:`~otmorris.MorrisExperiment`
+outputSample : :py:class:`openturns.Sample`
+    Response model applied on `inputSample`, typically a discretized field of large dimension :math:`q`
+interval : :py:class:`openturns.Interval`
+    Bounds of the experiment inputs.
+componentsNumber : int
+    Number :math:`k` of principal components
+
+Notes
+-----
+For time-series or spatial outputs, the :math:`q` outputs are strongly correlated
+and the screening does not need one set of indices per node.
+The centered output sample :math:`Y_c` is projected onto its :math:`k` leading
+principal directions :math:`U_k` (:math:`q \times k`), computed by a randomized SVD
+(Halko, Martinsson and Tropp, 2011): a Gaussian sketch :math:`Y_c \Omega` with
+:math:`k + 10` columns, two power iterations, a QR factorization :math:`Q` and the SVD of
+the small matrix :math:`Y_c^T Q`. Each product is a single pass over the sample,
+the centered sample is never stored.
+The sketch is drawn from the current state of :class:`openturns.RandomGenerator`,
+which is restored afterwards: the decomposition is reproducible for a given seed
+and the random stream of the caller is not consumed.
+
+The elementary effects are then computed on the :math:`k` scores :math:`Y_c U_k`
+instead of the :math:`q` outputs, and only the scores are kept as output sample.
+The accessors of :class:`~otmorris.Morris` give the statistics of each component.
+The generalized indices aggregate them for each input :math:`i`:
+
+.. math::
+
+    \mu_i = \sqrt{\sum_{c=1}^k \mu_{c,i}^2}, \quad
+    \mu^*_i = \sqrt{\sum_{c=1}^k {\mu^*_{c,i}}^2}, \quad
+    \sigma_i = \sqrt{\sum_{c=1}^k \sigma_{c,i}^2}
+
+As :math:`U_k` is orthonormal, :math:`\mu_i` is the norm of the mean elementary effect
+of the field and :math:`\sigma_i` the square root of the trace of its covariance, up to
+the part of the field outside the :math:`k` components.
+Comparing :meth:`getEigenValues` to the total variance of the outputs helps choosing :math:`k`.
+
+Examples
+--------
+>>> import openturns as ot
+>>> import otmorris
+>>> ot.RandomGenerator.SetSeed(0)
+>>> experiment = otmorris.MorrisExperimentGrid([5] * 3, 20)
+>>> X = experiment.generate()
+>>> t = [0.01 * j for j in range(100)]
+>>> Y = ot.Sample([[x[0] * tj + x[1] ** 2 * (1.0 - tj) for tj in t] for x in X])
+>>> morris = otmorris.MorrisPrincipalComponents(X, Y, experiment.getBounds(), 2)
+>>> mu = morris.getGeneralizedMeanElementaryEffects()
+)RAW"
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMORRIS::MorrisPrincipalComponents::getGeneralizedMeanElementaryEffects
+"Get the generalized mean of elementary effects.
+
+Returns
+-------
+mean: :py:class:`openturns.Point`
+    Norm over the components of the mean effects of each input.
+"
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMORRIS::MorrisPrincipalComponents::getGeneralizedMeanAbsoluteElementaryEffects
+"Get the generalized mean of absolute elementary effects.
+
+Returns
+-------
+mean: :py:class:`openturns.Point`
+    Norm over the components of the mean absolute effects of each input.
+"
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMORRIS::MorrisPrincipalComponents::getGeneralizedStandardDeviationElementaryEffects
+"Get the generalized standard deviation of elementary effects.
+
+Returns
+-------
+sigma: :py:class:`openturns.Point`
+    Norm over the components of the standard deviation of the effects of each input.
+"
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMORRIS::MorrisPrincipalComponents::getComponentsNumber
+"Accessor to the number of principal components.
+
+Returns
+-------
+componentsNumber : int
+    Number of principal components
+"
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMORRIS::MorrisPrincipalComponents::getBasis
+"Accessor to the principal directions.
+
+Returns
+-------
+basis : :py:class:`openturns.Matrix`
+    Orthonormal :math:`q \times k` matrix of the principal directions
+"
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMORRIS::MorrisPrincipalComponents::getOutputMean
+"Accessor to the mean of the outputs.
+
+Returns
+-------
+mean : :py:class:`openturns.Point`
+    Mean of the output sample, subtracted before the projection
+"
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMORRIS::MorrisPrincipalComponents::getEigenValues
+"Accessor to the variance of the principal components.
+
+Returns
+-------
+eigenValues : :py:class:`openturns.Point`
+    Variance of each component, in decreasing order
+"
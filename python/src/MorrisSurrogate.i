@@ -0,0 +1,11 @@
+// SWIG file
+
+%{
+#include "otmorris/MorrisSurrogate.hxx"
+%}
+
+%include MorrisSurrogate_doc.i
+
+%copyctor OTMORRIS::MorrisSurrogate;
+
+%include otmorris/MorrisSurrogate.hxx
@@ -0,0 +1,87 @@
+%feature("docstring") OTMORRIS::MorrisSurrogate
+R"RAW(Morris method on a metamodel.
+
+Parameters
+----------
+experiment : :py:class:`otmorris.MorrisExperiment`
+    Morris experiment, possibly with a large number of trajectories
+model : :py:class:`openturns.Function`
+    Response model, evaluated only `trainingSize` times
+trainingSize : int
+    Number of evaluations of the model used to train the metamodel
+
+Notes
+-----
+When a single evaluation of the model is very expensive, even :math:`r (p + 1)`
+simulations can be out of reach. The model is then evaluated on an LHS design
+of size `trainingSize`, uniform over the bounds of the experiment, and a
+polynomial chaos metamodel is trained with :py:class:`openturns.FunctionalChaosAlgorithm`.
+All the trajectories of the experiment are then evaluated on the metamodel in a single
+batch, and the elementary effects are computed as in :class:`~otmorris.Morris`.
+
+The accuracy of the metamodel is given by the K-fold (:math:`K=5`) predictivity factor:
+
+.. math::
+
+    Q_2 = 1 - \frac{\sum_{k=1}^{n} (y_k - \tilde{y}_{-k})^2}{\sum_{k=1}^{n} (y_k - \bar{y})^2}
+
+where :math:`\tilde{y}_{-k}` is the prediction of a metamodel trained without the fold of :math:`y_k`.
+Values close to 1 indicate that the screening on the metamodel is representative of the model.
+If an output is constant on the training design, :math:`Q_2` is 1 when the metamodel
+reproduces it and 0 otherwise.
+
+Examples
+--------
+>>> import openturns as ot
+>>> import otmorris
+>>> ot.RandomGenerator.SetSeed(0)
+>>> model = ot.SymbolicFunction(['x', 'y', 'z'], ['x + 2 * y^2 + x * z'])
+>>> experiment = otmorris.MorrisExperimentGrid([5] * 3, 200)
+>>> morris = otmorris.MorrisSurrogate(experiment, model, 30)
+>>> q2 = morris.getPredictivityFactor()
+>>> mu_star = morris.getMeanAbsoluteElementaryEffects()
+)RAW"
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMORRIS::MorrisSurrogate::getMetaModel
+"Accessor to the metamodel.
+
+Returns
+-------
+metaModel : :py:class:`openturns.Function`
+    Polynomial chaos metamodel of the model
+"
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMORRIS::MorrisSurrogate::getTrainingInputSample
+"Accessor to the training input sample.
+
+Returns
+-------
+inputSample : :py:class:`openturns.Sample`
+    Points where the model has been evaluated
+"
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMORRIS::MorrisSurrogate::getTrainingOutputSample
+"Accessor to the training output sample.
+
+Returns
+-------
+outputSample : :py:class:`openturns.Sample`
+    Evaluations of the model
+"
+
+// ---------------------------------------------------------------------
+
+%feature("docstring") OTMORRIS::MorrisSurrogate::getPredictivityFactor
+"Accessor to the predictivity factor of the metamodel.
+
+Returns
+-------
+q2 : :py:class:`openturns.Point`
+    K-fold cross-validation predictivity factor of each output
+"
@@ -54,6 +54,13 @@ The mean explains the sensitivity whereas the standard deviation explains the in
 
 With the first constructor, we consider that input experiment has been generated thanks to the :class:`~otmorris.MorrisExperiment` and output is evaluated outside the platform.
 With second constructor, the output is evaluated inside the platform.
+In that case, points shared by several trajectories (the same starting point of an LHS design,
+the same node of a grid) are evaluated only once, see :meth:`getSavedCallsNumber`.
+
+When saved in a :py:class:`openturns.Study` with :py:class:`openturns.XMLH5StorageManager`,
+the input and output samples are stored as binary HDF5 datasets instead of XML text,
+which keeps large studies compact and fast to save. Loading a study reads
+all the objects it contains, samples included.
 
 Examples
 --------
@@ -156,20 +163,59 @@ inputSample : :py:class:`openturns.Sample`
 
 // ---------------------------------------------------------------------
 
+%feature("docstring") OTMORRIS::Morris::getSavedCallsNumber
+"Accessor to the number of saved model evaluations.
+
+When the model is given, the duplicated points of the design are evaluated
+only once. Points are compared after normalization by the bounds, up to a
+relative precision of :math:`2^{-40}`.
+
+Returns
+-------
+savedCallsNumber : int
+    Number of points of the input sample that were not evaluated by the model
+    because they duplicate another point of the design
+"
+
+// ---------------------------------------------------------------------
+
 %feature("docstring") OTMORRIS::Morris::drawElementaryEffects
 "Draw elementary effects.
 
 Plots mean vs standard deviation of elementary effects.
 
+Available usages:
+
+    drawElementaryEffects(*marginal=0, absoluteMean=True, labelsNumber=all, rankBySigma=False, binNumber=0*)
+
+    drawElementaryEffects(*marginals, absoluteMean=True, labelsNumber=all, rankBySigma=False, binNumber=0*)
+
 Parameters
 ----------
 marginal : int
     Output marginal of interest
+marginals : sequence of int
+    Output marginals of interest, drawn in a grid of graphs
 absoluteMean : bool, default=True
     Whether to use absolute mean
+labelsNumber : int, optional
+    Number of inputs labelled with their description: only the most
+    influential ones are labelled. By default all inputs are labelled.
+rankBySigma : bool, default=False
+    Whether the most influential inputs are those with the largest standard
+    deviation instead of the largest (absolute) mean
+binNumber : int, default=0
+    If positive, the inputs that are not labelled are rendered as a density
+    map of `binNumber` x `binNumber` cells instead of individual points,
+    which keeps the graph light for thousands of inputs
 
 Returns
 -------
-mean: :py:class:`openturns.Graph`
-    The elementary effects graph
+graph : :py:class:`openturns.Graph` or :py:class:`openturns.GridLayout`
+    The elementary effects graph, or a grid of graphs when several marginals are given
+
+Notes
+-----
+The most influential inputs are found by partial selection, in linear time
+with respect to the input dimension.
 "
@@ -22,4 +22,8 @@
 %include MorrisExperimentGrid.i
 %include MorrisExperimentLHS.i
 %include Morris.i
+%include MorrisDatabase.i
+%include MorrisSurrogate.i
+%include MorrisPrincipalComponents.i
+%include MorrisEnsemble.i
 
@@ -0,0 +1,56 @@
+#!/usr/bin/env python
+
+import openturns as ot
+import openturns.testing as ott
+import otmorris
+
+ot.RandomGenerator.SetSeed(0)
+
+# full factorial design with a linear model: exact effects
+model = ot.SymbolicFunction(["x", "y", "z"], ["2 * x - 3 * y + z", "x * y"])
+bounds = ot.Interval([0.0, -1.0, 1.0], [1.0, 1.0, 3.0])
+levels = [3, 4, 5]
+X = ot.Box(levels, bounds).generate()
+Y = model(X)
+morris = otmorris.MorrisDatabase(X, Y, bounds, 1e-6)
+# along each axis, the pairs are consecutive nodes of the grid lines
+size = X.getSize()
+expected = [size // (n + 2) * (n + 1) for n in levels]
+assert morris.getPairsNumber() == expected, "pairs number"
+# effects are normalized by the bounds as in Morris
+ott.assert_almost_equal(morris.getMeanElementaryEffects(0), [2.0, -6.0, 2.0])
+ott.assert_almost_equal(morris.getStandardDeviationElementaryEffects(0), [0.0] * 3, 0.0, 1e-10)
+
+# shuffled database with noisy coordinates: same result with a tolerance
+X2 = X + ot.Normal([0.0] * 3, [1e-9] * 3, ot.CorrelationMatrix(3)).getSample(size)
+permutation = ot.KPermutationsDistribution(size, size).getRealization()
+X2 = X2.select([int(k) for k in permutation])
+morris2 = otmorris.MorrisDatabase(X2, model(X2), bounds, 1e-6)
+assert morris2.getPairsNumber() == expected, "pairs number, shuffled"
+ott.assert_almost_equal(
+    morris2.getMeanAbsoluteElementaryEffects(0), [2.0, 6.0, 2.0], 1e-6, 1e-6
+)
+
+# Morris trajectories are valid databases too
+experiment = otmorris.MorrisExperimentGrid(levels, 10, bounds)
+X3 = experiment.generate()
+morris3 = otmorris.MorrisDatabase(X3, model(X3), bounds, 1e-6)
+assert min(morris3.getPairsNumber()) > 0, "pairs in trajectories"
+ott.assert_almost_equal(morris3.getMeanElementaryEffects(0), [2.0, -6.0, 2.0])
+
+# steps smaller than ten times the tolerance are rejected: the y mismatch
+# of the pair (0, 0) - (0.05, 0.01) would dominate its effect along x
+model4 = ot.SymbolicFunction(["x", "y"], ["x + 10 * y"])
+X4 = ot.Sample([[0.0, 0.0], [0.05, 0.01], [0.5, 0.0]])
+morris4 = otmorris.MorrisDatabase(X4, model4(X4), ot.Interval(2), 0.02)
+assert morris4.getPairsNumber() == [2, 0], "minimum step"
+ott.assert_almost_equal(
+    morris4.getMeanElementaryEffects(0)[0], 0.5 * (1.0 + 0.35 / 0.45)
+)
+
+# zero-width bounds are rejected
+try:
+    otmorris.MorrisDatabase(X4, model4(X4), ot.Interval([0.0, 0.0], [1.0, 0.0]), 0.02)
+    raise AssertionError("zero-width bounds should be rejected")
+except TypeError:
+    pass
@@ -0,0 +1,88 @@
+#!/usr/bin/env python
+
+import openturns as ot
+import openturns.testing as ott
+import otmorris
+
+
+class CountingFunction(ot.OpenTURNSPythonFunction):
+    def __init__(self):
+        super(CountingFunction, self).__init__(4, 2)
+        self.calls = 0
+        self.points = 0
+
+    def _exec_sample(self, X):
+        self.calls += 1
+        self.points += len(X)
+        return [[x[0] + 2.0 * x[1] ** 2 + x[0] * x[2], x[3] - x[1]] for x in X]
+
+
+ot.RandomGenerator.SetSeed(0)
+counter = CountingFunction()
+model = ot.Function(counter)
+bounds = ot.Interval([0.0, -1.0, 1.0, 0.0], [1.0, 1.0, 2.0, 10.0])
+experiment = otmorris.MorrisExperimentGrid([5] * 4, 10, bounds)
+assert experiment.isShardable(), "shardable grid"
+R = 6
+ensemble = otmorris.MorrisEnsemble(experiment, model, R)
+
+# a single batch for all the replicates
+assert counter.calls == 1, "model calls"
+assert ensemble.getReplicatesNumber() == R, "replicates number"
+assert ensemble.getInputSample().getSize() == R * 10 * 5, "design size"
+# duplicated points (shared grid nodes) are evaluated once
+saved = ensemble.getSavedCallsNumber()
+assert saved > 0, "saved calls"
+assert counter.points == R * 10 * 5 - saved, "evaluated points"
+seeds = ensemble.getSeeds()
+assert len(set(seeds)) == R, "distinct seeds"
+
+for marginal in range(2):
+    muStar = ensemble.getMeanAbsoluteElementaryEffectsSample(marginal)
+    mu = ensemble.getMeanElementaryEffectsSample(marginal)
+    sigma = ensemble.getStandardDeviationElementaryEffectsSample(marginal)
+    assert muStar.getSize() == R and muStar.getDimension() == 4, "statistics size"
+    # each replicate is the screening of its own design
+    for r in range(R):
+        X = experiment.generateShard(0, 1, seeds[r])
+        reference = otmorris.Morris(X, model(X), bounds)
+        ott.assert_almost_equal(
+            muStar[r], reference.getMeanAbsoluteElementaryEffects(marginal)
+        )
+        ott.assert_almost_equal(mu[r], reference.getMeanElementaryEffects(marginal))
+        ott.assert_almost_equal(
+            sigma[r], reference.getStandardDeviationElementaryEffects(marginal)
+        )
+        replicate = ensemble.getReplicate(r)
+        ott.assert_almost_equal(
+            replicate.getMeanElementaryEffects(marginal),
+            reference.getMeanElementaryEffects(marginal),
+        )
+    # spread across the replicates
+    ott.assert_almost_equal(
+        ensemble.getMeanAbsoluteElementaryEffectsSpread(marginal),
+        muStar.computeStandardDeviation(),
+    )
+    ott.assert_almost_equal(
+        ensemble.getStandardDeviationElementaryEffectsSpread(marginal),
+        sigma.computeStandardDeviation(),
+    )
+
+# linear second output: no spread
+ott.assert_almost_equal(
+    ensemble.getMeanElementaryEffectsSpread(1), [0.0] * 4, 0.0, 1e-10
+)
+
+# small LHS design: too few starting points for sharded designs
+lhs = ot.LHSExperiment(ot.JointDistribution([ot.Uniform(0.0, 1.0)] * 4), 3).generate()
+experiment = otmorris.MorrisExperimentLHS(lhs, 20)
+assert not experiment.isShardable(), "not shardable LHS"
+counter.points = 0
+ensemble = otmorris.MorrisEnsemble(experiment, model, 4)
+assert ensemble.getInputSample().getSize() == 4 * 20 * 5, "design size, LHS"
+assert counter.points == 4 * 20 * 5 - ensemble.getSavedCallsNumber(), "evaluated points, LHS"
+seeds = ensemble.getSeeds()
+# each design is the one generated from the seed of the replicate
+ot.RandomGenerator.SetSeed(seeds[2])
+X = experiment.generate()
+ott.assert_almost_equal(ensemble.getReplicate(2).getInputSample(), X)
@@ -0,0 +1,41 @@
+#!/usr/bin/env python
+
+import openturns as ot
+import openturns.testing as ott
+import otmorris
+
+ot.RandomGenerator.SetSeed(0)
+
+lhs = ot.LHSExperiment(
+    ot.JointDistribution([ot.Uniform(0.0, 1.0)] * 3), 10, True, False
+).generate()
+r = 25
+seed = 1234
+for experiment in [
+    otmorris.MorrisExperimentGrid([4] * 3, r),
+    otmorris.MorrisExperimentLHS(lhs, r),
+]:
+    dim = experiment.getBounds().getDimension()
+    state = ot.RandomGenerator.GetState()
+    u = ot.RandomGenerator.Generate()
+    ot.RandomGenerator.SetState(state)
+    full = experiment.generateShard(0, 1, seed)
+    assert full.getSize() == r * (dim + 1), "size"
+    # the generator state is untouched
+    assert ot.RandomGenerator.Generate() == u, "state"
+
+    # concatenated shards give the full design whatever the number of shards
+    for shardNumber in [2, 3, 7]:
+        shards = ot.Sample(0, dim)
+        for shardIndex in range(shardNumber):
+            shards.add(experiment.generateShard(shardIndex, shardNumber, seed))
+        ott.assert_almost_equal(shards, full, 0.0, 0.0)
+
+    # the trajectories are distinct
+    trajectories = ot.Sample(r, dim * (dim + 1))
+    trajectories.getImplementation().setData(full.asPoint())
+    assert trajectories.sortUnique().getSize() == r, "unique"
+
+    # another seed gives another design
+    other = experiment.generateShard(0, 1, seed + 1)
+    assert other != full, "seed"
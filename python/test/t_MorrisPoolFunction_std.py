@@ -0,0 +1,41 @@
+#!/usr/bin/env python
+
+import openturns as ot
+import openturns.testing as ott
+import otmorris
+
+
+if __name__ == "__main__":
+    ot.RandomGenerator.SetSeed(0)
+    b0 = ot.DistFunc.rNormal()
+    alpha = ot.DistFunc.rNormal(10)
+    beta = ot.DistFunc.rNormal(6 * 14)
+    gamma = ot.DistFunc.rNormal(20 * 14)
+    model = otmorris.MorrisFunction(alpha, beta, gamma, b0)
+    serial = ot.Function(model)
+    pool = ot.Function(otmorris.MorrisPoolFunction(model, 2))
+    assert pool.getInputDimension() == 20, "input dimension"
+    assert pool.getOutputDimension() == 1, "output dimension"
+
+    experiment = otmorris.MorrisExperimentGrid([5] * 20, 10)
+    X = experiment.generate()
+
+    # same values as the serial evaluation, whatever the blocks
+    Y = serial(X)
+    ott.assert_almost_equal(pool(X), Y, 0.0, 0.0)
+    for blockSize in [1, 3, 100]:
+        blocks = ot.Function(otmorris.MorrisPoolFunction(model, 3, blockSize))
+        ott.assert_almost_equal(blocks(X), Y, 0.0, 0.0)
+    # single point, evaluated in the calling process
+    ott.assert_almost_equal(pool(X[0]), Y[0], 0.0, 0.0)
+
+    # same screening
+    bounds = experiment.getBounds()
+    reference = otmorris.Morris(X, Y, bounds)
+    morris = otmorris.Morris(X, pool(X), bounds)
+    ott.assert_almost_equal(
+        morris.getMeanAbsoluteElementaryEffects(),
+        reference.getMeanAbsoluteElementaryEffects(),
+        0.0,
+        0.0,
+    )
@@ -0,0 +1,50 @@
+#!/usr/bin/env python
+
+import openturns as ot
+import openturns.testing as ott
+import otmorris
+import math
+
+ot.RandomGenerator.SetSeed(0)
+
+# field output of rank 2 over 200 time steps
+bounds = ot.Interval([0.0, -1.0, 1.0], [1.0, 1.0, 2.0])
+experiment = otmorris.MorrisExperimentGrid([5] * 3, 30, bounds)
+X = experiment.generate()
+t = [j / 199.0 for j in range(200)]
+Y = ot.Sample(
+    [[x[0] * math.sin(3.0 * tj) + x[1] ** 2 * math.cos(tj) for tj in t] for x in X]
+)
+morris = otmorris.MorrisPrincipalComponents(X, Y, bounds, 2)
+assert morris.getComponentsNumber() == 2, "components number"
+assert morris.getOutputSample().getDimension() == 2, "scores"
+assert morris.getBasis().getNbRows() == 200, "basis"
+ott.assert_almost_equal(morris.getOutputMean(), Y.computeMean())
+
+# all the variance is in the two components
+eigenValues = morris.getEigenValues()
+ott.assert_almost_equal(sum(eigenValues), sum(Y.computeVariance()), 1e-8, 1e-8)
+assert eigenValues[0] >= eigenValues[1], "decreasing eigen values"
+
+# generalized indices are the norms of the effects of the whole field
+reference = otmorris.Morris(X, Y, bounds)
+for i, (mu, sigma) in enumerate(
+    zip(
+        morris.getGeneralizedMeanElementaryEffects(),
+        morris.getGeneralizedStandardDeviationElementaryEffects(),
+    )
+):
+    mean = [reference.getMeanElementaryEffects(j)[i] for j in range(200)]
+    std = [reference.getStandardDeviationElementaryEffects(j)[i] for j in range(200)]
+    ott.assert_almost_equal(mu, math.sqrt(sum(m * m for m in mean)), 1e-8, 1e-8)
+    ott.assert_almost_equal(sigma, math.sqrt(sum(s * s for s in std)), 1e-8, 1e-8)
+
+# third input has no effect
+ott.assert_almost_equal(
+    morris.getGeneralizedMeanAbsoluteElementaryEffects()[2], 0.0, 0.0, 1e-8
+)
+
+# the sketch leaves the random generator state untouched
+state = ot.RandomGenerator.GetState()
+otmorris.MorrisPrincipalComponents(X, Y, bounds, 2)
+assert ot.RandomGenerator.GetState() == state, "generator state"
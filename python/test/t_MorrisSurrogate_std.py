@@ -0,0 +1,47 @@
+#!/usr/bin/env python
+
+import openturns as ot
+import openturns.testing as ott
+import otmorris
+
+ot.RandomGenerator.SetSeed(0)
+
+# polynomial model: the metamodel is exact
+model = ot.SymbolicFunction(["x", "y", "z"], ["x + 2 * y^2 + x * z", "3 * z - y"])
+bounds = ot.Interval([0.0, -1.0, 1.0], [1.0, 1.0, 2.0])
+experiment = otmorris.MorrisExperimentGrid([5] * 3, 100, bounds)
+trainingSize = 40
+morris = otmorris.MorrisSurrogate(experiment, model, trainingSize)
+
+assert morris.getTrainingInputSample().getSize() == trainingSize, "budget"
+assert morris.getInputSample().getSize() == 100 * 4, "design"
+q2 = morris.getPredictivityFactor()
+assert min(q2) > 0.99, "predictivity %s" % q2
+
+# same statistics as the Morris method on the real model
+X = morris.getInputSample()
+reference = otmorris.Morris(X, model(X), bounds)
+for marginal in range(2):
+    ott.assert_almost_equal(
+        morris.getMeanAbsoluteElementaryEffects(marginal),
+        reference.getMeanAbsoluteElementaryEffects(marginal),
+        1e-3,
+        1e-3,
+    )
+    ott.assert_almost_equal(
+        morris.getStandardDeviationElementaryEffects(marginal),
+        reference.getStandardDeviationElementaryEffects(marginal),
+        1e-3,
+        1e-3,
+    )
+
+# constant outputs: no division by their zero variance
+model = ot.SymbolicFunction(["x", "y", "z"], ["x + 2 * y^2 + x * z", "2.0", "0.0"])
+morris = otmorris.MorrisSurrogate(experiment, model, trainingSize)
+q2 = morris.getPredictivityFactor()
+assert q2[1] == 1.0, "predictivity of a constant output %s" % q2
+assert q2[2] == 1.0, "predictivity of a zero output %s" % q2
+for marginal in [1, 2]:
+    ott.assert_almost_equal(
+        morris.getMeanAbsoluteElementaryEffects(marginal), [0.0] * 3, 0.0, 1e-8
+    )
@@ -0,0 +1,40 @@
+#!/usr/bin/env python
+
+import openturns as ot
+import otmorris
+
+ot.RandomGenerator.SetSeed(0)
+
+# many inputs, two outputs
+dim = 500
+r = 3
+coefficients = [ot.RandomGenerator.Generate() ** 4 for i in range(dim)]
+inputs = ["x%d" % i for i in range(dim)]
+sum1 = " + ".join(["%g * %s" % (c, x) for c, x in zip(coefficients, inputs)])
+sum2 = " + ".join(["%g * %s^2" % (c, x) for c, x in zip(coefficients, inputs)])
+model = ot.SymbolicFunction(inputs, [sum1, sum2])
+experiment = otmorris.MorrisExperimentGrid([5] * dim, r)
+morris = otmorris.Morris(experiment, model)
+
+# all inputs labelled: single cloud, single text drawable
+graph = morris.drawElementaryEffects()
+assert len(graph.getDrawables()) == 2, "default graph"
+assert len(graph.getDrawable(1).getTextAnnotations()) == dim, "all labels"
+
+# top-k labels ranked by mu*
+k = 10
+graph = morris.drawElementaryEffects(0, True, k)
+labels = graph.getDrawable(1).getTextAnnotations()
+assert len(labels) == k, "top-k labels"
+mu = morris.getMeanAbsoluteElementaryEffects()
+threshold = sorted(mu, reverse=True)[k - 1]
+for label in labels:
+    assert mu[inputs.index(label)] >= threshold, "top-k selection"
+
+# density rendering of the other inputs
+graph = morris.drawElementaryEffects(0, True, k, True, 20)
+assert graph.getDrawable(0).getImplementation().getClassName() == "PolygonArray"
+
+# several outputs at once
+grid = morris.drawElementaryEffects([0, 1], True, k, False, 20)
+assert grid.getNbRows() * grid.getNbColumns() >= 2, "grid"
@@ -0,0 +1,42 @@
+#!/usr/bin/env python
+
+import openturns as ot
+import openturns.testing as ott
+import otmorris
+
+ot.RandomGenerator.SetSeed(0)
+
+model = ot.SymbolicFunction(["x", "y"], ["cos(x)*y + sin(y)*x + x*y -0.1"])
+bounds = ot.Interval([-1.0, 0.0], [1.0, 2.0])
+
+# LHS design smaller than the number of trajectories:
+# some trajectories start from the same point
+size = 5
+r = 12
+dist = ot.JointDistribution([ot.Uniform(-1.0, 1.0), ot.Uniform(0.0, 2.0)])
+lhsDesign = ot.LHSExperiment(dist, size, True, False).generate()
+experiment = otmorris.MorrisExperimentLHS(lhsDesign, r, bounds)
+morris = otmorris.Morris(experiment, model)
+X = morris.getInputSample()
+Y = morris.getOutputSample()
+assert morris.getSavedCallsNumber() >= r - size, "duplicated starting points"
+
+# the output sample must be the same as a full evaluation
+ott.assert_almost_equal(Y, model(X))
+reference = otmorris.Morris(X, model(X), bounds)
+ott.assert_almost_equal(
+    morris.getMeanAbsoluteElementaryEffects(),
+    reference.getMeanAbsoluteElementaryEffects(),
+)
+ott.assert_almost_equal(
+    morris.getStandardDeviationElementaryEffects(),
+    reference.getStandardDeviationElementaryEffects(),
+)
+
+# grid design: nodes shared by several trajectories are evaluated once
+experiment = otmorris.MorrisExperimentGrid([3, 3], 6, bounds)
+morris = otmorris.Morris(experiment, model)
+X = morris.getInputSample()
+distinct = X.sortUnique().getSize()
+assert morris.getSavedCallsNumber() == X.getSize() - distinct, "grid duplicates"
+ott.assert_almost_equal(morris.getOutputSample(), model(X))
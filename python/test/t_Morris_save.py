@@ -0,0 +1,48 @@
+#!/usr/bin/env python
+
+import openturns as ot
+import openturns.testing as ott
+import otmorris
+import os
+import shutil
+from tempfile import mkdtemp
+
+ot.RandomGenerator.SetSeed(0)
+
+model = ot.SymbolicFunction(["x", "y", "z"], ["x + 2 * y * z", "x * y - z"])
+experiment = otmorris.MorrisExperimentGrid([5] * 3, 20)
+morris = otmorris.Morris(experiment, model)
+
+work_dir = mkdtemp()
+managers = [ot.XMLStorageManager]
+if hasattr(ot, "XMLH5StorageManager"):
+    managers.append(ot.XMLH5StorageManager)
+for manager in managers:
+    fileName = os.path.join(work_dir, "morris_%s.xml" % manager.__name__)
+    study = ot.Study(fileName)
+    study.setStorageManager(manager(fileName))
+    study.add("morris", morris)
+    study.save()
+
+    # load
+    study = ot.Study(fileName)
+    study.setStorageManager(manager(fileName))
+    study.load()
+    loaded = otmorris.Morris()
+    study.fillObject("morris", loaded)
+    ott.assert_almost_equal(loaded.getInputSample(), morris.getInputSample())
+    ott.assert_almost_equal(loaded.getOutputSample(), morris.getOutputSample())
+    assert loaded.getSavedCallsNumber() == morris.getSavedCallsNumber()
+    for marginal in range(2):
+        ott.assert_almost_equal(
+            loaded.getMeanAbsoluteElementaryEffects(marginal),
+            morris.getMeanAbsoluteElementaryEffects(marginal),
+        )
+        ott.assert_almost_equal(
+            loaded.getStandardDeviationElementaryEffects(marginal),
+            morris.getStandardDeviationElementaryEffects(marginal),
+        )
+    graph = loaded.drawElementaryEffects(1)
+    assert list(graph.getDrawable(1).getTextAnnotations()) == ["x", "y", "z"]
+
+shutil.rmtree(work_dir)
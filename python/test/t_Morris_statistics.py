@@ -0,0 +1,51 @@
+#!/usr/bin/env python
+
+import openturns as ot
+import openturns.testing as ott
+import otmorris
+
+ot.RandomGenerator.SetSeed(0)
+
+# several outputs, non unit bounds
+model = ot.SymbolicFunction(
+    ["x", "y", "z"], ["x + 2 * y^2 + x * z", "sin(y) * z", "exp(0.5 * x) - z^3"]
+)
+bounds = ot.Interval([0.0, -1.0, 1.0], [1.0, 1.0, 3.0])
+experiment = otmorris.MorrisExperimentGrid([5] * 3, 25, bounds)
+X = experiment.generate()
+Y = model(X)
+morris = otmorris.Morris(X, Y, bounds)
+
+# explicit elementary effects: each step of a trajectory moves a single input
+dim = X.getDimension()
+outputDimension = Y.getDimension()
+N = X.getSize() // (dim + 1)
+width = bounds.getUpperBound() - bounds.getLowerBound()
+effects = [ot.Sample(N, dim) for j in range(outputDimension)]
+for k in range(N):
+    for i in range(dim):
+        a = k * (dim + 1) + i
+        steps = [(X[a + 1, p] - X[a, p]) / width[p] for p in range(dim)]
+        moved = [p for p in range(dim) if steps[p] != 0.0]
+        assert len(moved) == 1, "one at a time"
+        p = moved[0]
+        for j in range(outputDimension):
+            effects[j][k, p] = (Y[a + 1, j] - Y[a, j]) / steps[p]
+
+for j in range(outputDimension):
+    absoluteEffects = ot.Sample([[abs(e) for e in point] for point in effects[j]])
+    ott.assert_almost_equal(
+        morris.getMeanElementaryEffects(j), effects[j].computeMean(), 1e-10, 1e-10
+    )
+    ott.assert_almost_equal(
+        morris.getMeanAbsoluteElementaryEffects(j),
+        absoluteEffects.computeMean(),
+        1e-10,
+        1e-10,
+    )
+    ott.assert_almost_equal(
+        morris.getStandardDeviationElementaryEffects(j),
+        effects[j].computeStandardDeviation(),
+        1e-10,
+        1e-10,
+    )